@@ -0,0 +1,223 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+// Microbenchmarks of the building blocks of the simulation and of full sweeps.
+// Every benchmark is run a few times to warm up and then timed repeatedly; the
+// median and the median absolute deviation (MAD) of the time per operation are
+// printed and written as JSON, so that the results of two builds can be diffed.
+
+#include "sweep.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Results are folded into this, so that the compiler cannot drop the work
+volatile std::uint64_t sink = 0;
+
+struct Benchmark {
+    std::string name;
+    std::size_t ops;                        // operations per run
+    std::function<std::uint64_t()> run;     // returns a checksum of its results
+};
+
+struct Result {
+    std::string name;
+    std::size_t ops;
+    std::vector<double> samples;            // ns per operation of each timed run
+    double median = 0., mad = 0.;
+};
+
+double median(std::vector<double> values)
+{
+    if (values.empty()) return 0.;
+    const std::size_t mid = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + mid, values.end());
+    if (values.size() % 2) return values[mid];
+    return (values[mid] + *std::max_element(values.begin(), values.begin() + mid)) / 2.;
+}
+
+Result measure(Benchmark const& benchmark, unsigned int warmup, unsigned int repetitions)
+{
+    Result result{benchmark.name, benchmark.ops, {}};
+    for (unsigned int i = 0; i < warmup; ++i) sink = sink + benchmark.run();
+    for (unsigned int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        sink = sink + benchmark.run();
+        const std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+        result.samples.push_back(ns.count() / benchmark.ops);
+    }
+    result.median = median(result.samples);
+    std::vector<double> deviations;
+    for (double sample : result.samples) deviations.push_back(std::abs(sample - result.median));
+    result.mad = median(deviations);
+    return result;
+}
+
+std::vector<std::size_t> parseSizes(std::string const& list)
+{
+    std::vector<std::size_t> sizes;
+    std::stringstream stream(list);
+    std::string size;
+    while (std::getline(stream, size, ','))
+        if (!size.empty()) sizes.push_back(std::stoul(size));
+    return sizes;
+}
+
+void usage()
+{
+    std::cout << "Usage: ./benchSuite [options]" << std::endl;
+    std::cout << "  --warmup=W    untimed runs of each benchmark before it is timed (default 2)" << std::endl;
+    std::cout << "  --reps=R      timed runs of each benchmark (default 9)" << std::endl;
+    std::cout << "  --sweep=N,... battles per cell of the full sweeps (default 1000,10000; none if empty)" << std::endl;
+    std::cout << "  --threads=T   threads of the full sweeps (default: the hardware threads)" << std::endl;
+    std::cout << "  --filter=S    only run the benchmarks whose name contains S" << std::endl;
+    std::cout << "  --json=F      write the results to F (default bench.json)" << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--help") {
+            usage();
+            return 0;
+        }
+    }
+    const unsigned int warmup = std::stoul(getOption(argc, argv, "warmup", "2"));
+    const unsigned int repetitions = std::stoul(getOption(argc, argv, "reps", "9"));
+    const auto sweepSizes = parseSizes(getOption(argc, argv, "sweep", "1000,10000"));
+    const unsigned int nThread = std::stoul(getOption(argc, argv, "threads", std::to_string(std::max(1u, std::thread::hardware_concurrency()))));
+    const std::string filter = getOption(argc, argv, "filter", "");
+    const std::string jsonPath = getOption(argc, argv, "json", "bench.json");
+    if (repetitions < 1 || nThread < 1) {
+        usage();
+        return 1;
+    }
+
+    // The microbenchmarks share one generator, which carries on from run to run
+    constexpr std::size_t ops = std::size_t(1) << 20;
+    RNG::RNG_t rng(0, 0);
+    std::vector<Benchmark> benchmarks;
+    benchmarks.push_back({"roll1d20", ops, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) sum += RNG::roll1d20(rng);
+        return sum;
+    }});
+    benchmarks.push_back({"roll2d20dl", ops, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) sum += RNG::roll2d20dl(rng);
+        return sum;
+    }});
+    benchmarks.push_back({"genRNG", ops, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) sum += RNG::genRNG(37, rng);
+        return sum;
+    }});
+    benchmarks.push_back({"random_encounter", ops, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) sum += dndSim::random_encounter(i % 20 + 1, dndSim::EncType::any, rng).getAC();
+        return sum;
+    }});
+    benchmarks.push_back({"premade", ops, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i)
+            sum += dndSim::with_premade(dndSim::PCClass(i % 4), i / 4 % 20 + 1, [](auto const& pc) { return pc.getSaveDC(); });
+        return sum;
+    }});
+    // Through the virtual interface, against the encounters of the character's level
+    const char* classNames[] = {"barbarian", "cleric", "rogue", "wizard"};
+    for (unsigned int l = 0; l < 4; ++l) {
+        const auto pcClass = dndSim::PCClass(l);
+        benchmarks.push_back({std::string(classNames[l]) + "::attack", ops, [&, pcClass] {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < ops; ++i) {
+                const unsigned short int lvl = i % 20 + 1;
+                dndSim::character const& pc = dndSim::with_premade(pcClass, lvl, [](auto const& pc) -> dndSim::character const& { return pc; });
+                sum += pc.attack(dndSim::random_encounter(lvl, dndSim::EncType::any, rng), rng);
+            }
+            return sum;
+        }});
+        benchmarks.push_back({std::string(classNames[l]) + "::save", ops, [&, pcClass] {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < ops; ++i) {
+                dndSim::character const& pc = dndSim::with_premade(pcClass, i % 20 + 1, [](auto const& pc) -> dndSim::character const& { return pc; });
+                sum += pc.save(i % 6, 10 + i % 11, rng);
+            }
+            return sum;
+        }});
+    }
+    // Full sweeps run the test suite's default sweep on a scheduler that is kept across
+    // runs, so that starting the threads is not timed. Each run still builds its
+    // threshold table, as every sweep of the test suite does.
+    dndSim::TaskScheduler scheduler(nThread);
+    for (std::size_t n : sweepSizes) {
+        benchmarks.push_back({"sweep/" + std::to_string(n), 1600 * n, [&, n] {
+            SweepOptions options;
+            options.n = n;
+            options.nThread = nThread;
+            options.scheduler = &scheduler;
+            float hit[4][20][20], def[4][20][20];
+            const SweepReport report = simulateRates(options, {hit[0], hit[1], hit[2], hit[3]}, {def[0], def[1], def[2], def[3]});
+            return std::uint64_t(hit[0][0][0] * 1e6) + report.trials.size();
+        }});
+    }
+
+    std::vector<Result> results;
+    std::cout << std::left << std::setw(24) << "benchmark" << std::right << std::setw(12) << "ns/op" << std::setw(12) << "MAD" << std::endl;
+    for (auto const& benchmark : benchmarks) {
+        if (benchmark.name.find(filter) == std::string::npos) continue;
+        results.push_back(measure(benchmark, warmup, repetitions));
+        auto const& result = results.back();
+        std::cout << std::left << std::setw(24) << result.name << std::right << std::setw(12) << result.median
+                  << std::setw(12) << result.mad << std::endl;
+    }
+
+    std::ofstream json(jsonPath);
+    if (!json) {
+        std::cerr << "Cannot write " << jsonPath << std::endl;
+        return 1;
+    }
+    json << "{\n  \"compiler\": \"" << __VERSION__ << "\",\n";
+#ifdef _OPENMP
+    json << "  \"openmp\": true,\n";
+#else
+    json << "  \"openmp\": false,\n";
+#endif
+    json << "  \"warmup\": " << warmup << ",\n  \"repetitions\": " << repetitions << ",\n  \"threads\": " << nThread << ",\n";
+    json << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        auto const& result = results[i];
+        json << (i ? "," : "") << "\n    {\"name\": \"" << result.name << "\", \"unit\": \"ns/op\", \"ops\": " << result.ops
+             << ", \"median\": " << result.median << ", \"mad\": " << result.mad << ", \"samples\": [";
+        for (std::size_t j = 0; j < result.samples.size(); ++j) json << (j ? ", " : "") << result.samples[j];
+        json << "]}";
+    }
+    json << "\n  ]\n}\n";
+    std::cout << "Wrote the results to " << jsonPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,265 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "catalog.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dndSim{
+
+static_assert(std::is_trivially_copyable_v<MonsterStats> && alignof(MonsterStats) == 1,
+              "MonsterStats is stored in the catalogue as raw bytes");
+static_assert(sizeof(CatalogHeader) % 64 == 0);
+
+namespace {
+
+constexpr std::size_t alignment = 64;
+
+std::size_t alignUp(std::size_t offset)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// The arrays of a mapped pool section, in the shape MonsterTable reads
+struct MappedColumns {
+    std::span<const MonsterStats> rows;
+    std::span<const std::int8_t> ac;
+    std::array<std::span<const std::int8_t>, 6> saves;
+    std::span<const std::int8_t> atkBonus, profBonus, saveDC;
+    std::span<const unsigned char> atkStat, causeSave;
+    std::span<const std::uint32_t> crOffset;
+};
+
+}
+
+CatalogLayout catalog_layout(std::size_t n)
+{
+    CatalogLayout layout;
+    std::size_t offset = 0;
+    auto place = [&](std::size_t bytes) {
+        const std::size_t start = offset;
+        offset = alignUp(offset + bytes);
+        return start;
+    };
+    layout.crOffset = place(21 * sizeof(std::uint32_t));
+    layout.rows = place(n * sizeof(MonsterStats));
+    layout.ac = place(n);
+    for (auto& save : layout.saves) save = place(n);
+    layout.atkBonus = place(n);
+    layout.profBonus = place(n);
+    layout.saveDC = place(n);
+    layout.atkStat = place(n);
+    layout.causeSave = place(n);
+    layout.size = offset;
+    return layout;
+}
+
+Catalog::Catalog(std::string const& path)
+{
+    if constexpr (std::endian::native != std::endian::little)
+        throw std::runtime_error("Catalogues can only be mapped on little-endian machines.");
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open catalogue " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(CatalogHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Catalogue " + path + " is too short");
+    }
+    length = st.st_size;
+    data = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        data = nullptr;
+        throw std::runtime_error("Cannot map catalogue " + path);
+    }
+
+    auto fail = [&](std::string const& what) {
+        ::munmap(data, length);
+        data = nullptr;
+        throw std::runtime_error("Invalid catalogue " + path + ": " + what);
+    };
+    auto const* bytes = static_cast<const unsigned char*>(data);
+    CatalogHeader header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (std::memcmp(header.magic, CatalogHeader::fileMagic, sizeof(header.magic)) != 0) fail("bad magic");
+    if (header.version != CatalogHeader::currentVersion) fail("unsupported version " + std::to_string(header.version));
+    if (header.rowSize != sizeof(MonsterStats)) fail("unexpected row size");
+    if (header.fileSize != length) fail("truncated");
+
+    for (int p = 0; p < 3; ++p) {
+        // Every row takes at least its own bytes, which bounds n before the layout multiplies it
+        const std::uint64_t n = header.size[p];
+        if (n > length / sizeof(MonsterStats)) fail("pool size out of bounds");
+        const CatalogLayout layout = catalog_layout(n);
+        if (header.offset[p] % alignment != 0 || header.offset[p] > length || length - header.offset[p] < layout.size)
+            fail("pool section out of bounds");
+        auto const* section = bytes + header.offset[p];
+        auto column = [&](std::size_t offset) { return std::span(reinterpret_cast<const std::int8_t*>(section + offset), n); };
+        auto bytesAt = [&](std::size_t offset) { return std::span(section + offset, n); };
+
+        MappedColumns columns;
+        columns.crOffset = std::span(reinterpret_cast<const std::uint32_t*>(section + layout.crOffset), 21);
+        columns.rows = std::span(reinterpret_cast<const MonsterStats*>(section + layout.rows), n);
+        columns.ac = column(layout.ac);
+        for (int k = 0; k < 6; ++k) columns.saves[k] = column(layout.saves[k]);
+        columns.atkBonus = column(layout.atkBonus);
+        columns.profBonus = column(layout.profBonus);
+        columns.saveDC = column(layout.saveDC);
+        columns.atkStat = bytesAt(layout.atkStat);
+        columns.causeSave = bytesAt(layout.causeSave);
+
+        if (columns.crOffset[0] != 0 || columns.crOffset[20] != n) fail("bad CR offsets");
+        for (int cr = 1; cr <= 20; ++cr) {
+            if (columns.crOffset[cr] <= columns.crOffset[cr - 1]) fail("empty or unordered CR");
+        }
+        // The attack stat indexes the saves of the target, and the save flags are read as
+        // bool, both from the columns and from the rows that encounters() builds npcs of
+        for (std::size_t i = 0; i < n; ++i) {
+            if (columns.atkStat[i] >= 6) fail("attack stat out of range");
+            if (columns.causeSave[i] > 1) fail("bad save flag");
+        }
+        for (int cr = 1; cr <= 20; ++cr) {
+            for (std::size_t i = columns.crOffset[cr - 1]; i < columns.crOffset[cr]; ++i) {
+                MonsterStats const& row = columns.rows[i];
+                if (row.lvlCR != cr) fail("row of the wrong CR");
+                if (row.atkStat >= 6) fail("attack stat out of range");
+                if (*reinterpret_cast<const unsigned char*>(&row.causeSave) > 1) fail("bad save flag");
+            }
+        }
+        pools[p] = dndSim::tables(columns);
+        sizes[p] = n;
+    }
+}
+
+Catalog::~Catalog()
+{
+    if (data) ::munmap(data, length);
+}
+
+void use_catalog(Catalog const& catalog)
+{
+    active_catalog = catalog.tables();
+}
+
+CatalogWriter::CatalogWriter(std::string const& path, Sizes const& sizes)
+    : path(path), out(path, std::ios::binary)
+{
+    CatalogHeader header {};
+    std::memcpy(header.magic, CatalogHeader::fileMagic, sizeof(header.magic));
+    header.version = CatalogHeader::currentVersion;
+    header.rowSize = sizeof(MonsterStats);
+    std::size_t end = sizeof(CatalogHeader);
+    for (int p = 0; p < 3; ++p) {
+        for (std::size_t n : sizes[p]) total[p] += n;
+        layout[p] = catalog_layout(total[p]);
+        header.size[p] = total[p];
+        header.offset[p] = offset[p] = end;
+        end += layout[p].size;
+    }
+    header.fileSize = end;
+
+    // The columns are written at their offsets, so the file gets its full length first
+    // and the padding between the arrays stays zero
+    out.seekp(end - 1);
+    out.put('\0');
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (int p = 0; p < 3; ++p) {
+        std::uint32_t crOffset[21] = {0};
+        for (int cr = 1; cr <= 20; ++cr) crOffset[cr] = crOffset[cr - 1] + sizes[p][cr - 1];
+        out.seekp(offset[p] + layout[p].crOffset);
+        out.write(reinterpret_cast<const char*>(crOffset), sizeof(crOffset));
+    }
+    if (!out) throw std::runtime_error("Cannot write catalogue " + path);
+}
+
+void CatalogWriter::append(EncType type, std::span<const MonsterStats> rows)
+{
+    constexpr std::size_t chunk = 1 << 16;
+    const int p = static_cast<int>(type);
+    while (!rows.empty()) {
+        const std::size_t m = std::min(rows.size(), chunk - pending[p].size());
+        pending[p].insert(pending[p].end(), rows.begin(), rows.begin() + m);
+        rows = rows.subspan(m);
+        if (pending[p].size() == chunk) flush(p);
+    }
+}
+
+void CatalogWriter::flush(int p)
+{
+    auto const& rows = pending[p];
+    if (written[p] + rows.size() > total[p]) throw std::runtime_error("More rows than counted for catalogue " + path);
+    const std::size_t section = offset[p], first = written[p];
+    out.seekp(section + layout[p].rows + first * sizeof(MonsterStats));
+    out.write(reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(MonsterStats));
+
+    std::vector<std::int8_t> column(rows.size());
+    auto writeColumn = [&](std::size_t at, auto field) {
+        std::transform(rows.begin(), rows.end(), column.begin(), field);
+        out.seekp(section + at + first);
+        out.write(reinterpret_cast<const char*>(column.data()), column.size());
+    };
+    writeColumn(layout[p].ac, [](MonsterStats const& m) { return m.ac; });
+    for (int k = 0; k < 6; ++k) writeColumn(layout[p].saves[k], [k](MonsterStats const& m) { return m.saves[k]; });
+    writeColumn(layout[p].atkBonus, [](MonsterStats const& m) { return m.atkBonus; });
+    writeColumn(layout[p].profBonus, [](MonsterStats const& m) { return m.profBonus; });
+    writeColumn(layout[p].saveDC, [](MonsterStats const& m) { return m.saveDC; });
+    writeColumn(layout[p].atkStat, [](MonsterStats const& m) { return std::int8_t(m.atkStat); });
+    writeColumn(layout[p].causeSave, [](MonsterStats const& m) { return std::int8_t(m.causeSave); });
+    written[p] += rows.size();
+    pending[p].clear();
+}
+
+void CatalogWriter::finish()
+{
+    for (int p = 0; p < 3; ++p) {
+        flush(p);
+        if (written[p] != total[p]) throw std::runtime_error("Fewer rows than counted for catalogue " + path);
+    }
+    out.close();
+    if (!out) throw std::runtime_error("Cannot write catalogue " + path);
+}
+
+void write_catalog(std::string const& path, CatalogRows const& rows)
+{
+    CatalogWriter::Sizes sizes;
+    for (int p = 0; p < 3; ++p) {
+        for (int cr = 0; cr < 20; ++cr) sizes[p][cr] = rows[p][cr].size();
+    }
+    CatalogWriter writer(path, sizes);
+    for (int p = 0; p < 3; ++p) {
+        for (auto const& cr : rows[p]) writer.append(EncType(p), cr);
+    }
+    writer.finish();
+}
+
+void write_catalog(std::string const& path, CatalogTables const& tables)
+{
+    CatalogRows rows;
+    for (int p = 0; p < 3; ++p) {
+        for (int cr = 0; cr < 20; ++cr) rows[p][cr] = (*tables[p])[cr].stats();
+    }
+    write_catalog(path, rows);
+}
+}
@@ -0,0 +1,112 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "dndSim.h"
+
+namespace dndSim{
+
+    // Binary monster catalogue, laid out like MonsterColumns so that it is used in
+    // place once mapped. All integers are little-endian. The file starts with a
+    // CatalogHeader, followed by one section per pool (any, spellcaster, regular),
+    // each holding the CR offsets and then the rows and the columns of the pool, every
+    // array starting on a 64-byte boundary (see catalog_layout).
+    struct CatalogHeader {
+        static constexpr char fileMagic[8] = {'T', 'A', 'D', 'D', 'S', 'C', 'A', 'T'};
+        static constexpr std::uint32_t currentVersion = 1;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t rowSize;            // sizeof(MonsterStats)
+        std::uint64_t fileSize;
+        std::uint64_t size[3];            // rows per pool
+        std::uint64_t offset[3];          // start of each pool section
+        std::uint8_t reserved[56];
+    };
+
+    // Byte offsets of the arrays of a pool section of n rows, relative to its start
+    struct CatalogLayout {
+        std::size_t crOffset, rows, ac, saves[6], atkBonus, profBonus, saveDC, atkStat, causeSave;
+        std::size_t size;
+    };
+    CatalogLayout catalog_layout(std::size_t n);
+
+    // A catalogue file mapped read-only and shared, so worker processes that load the
+    // same file share its pages. Throws std::runtime_error if the file cannot be
+    // mapped or is not a valid catalogue.
+    class Catalog {
+    public:
+        explicit Catalog(std::string const& path);
+        ~Catalog();
+        Catalog(Catalog const&) = delete;
+        Catalog& operator=(Catalog const&) = delete;
+
+        CatalogTables tables() const { return {&pools[0], &pools[1], &pools[2]}; }
+        std::size_t size(EncType type) const { return sizes[static_cast<int>(type)]; }
+
+    private:
+        void* data = nullptr;
+        std::size_t length = 0;
+        std::array<std::array<MonsterTable, 20>, 3> pools;
+        std::array<std::size_t, 3> sizes {};
+    };
+
+    // Draws encounters from the given catalogue instead of the built-in one. The
+    // catalogue has to outlive the simulation.
+    void use_catalog(Catalog const& catalog);
+
+    // The rows of a catalogue, indexed [EncType][CR - 1]
+    using CatalogRows = std::array<std::array<std::span<const MonsterStats>, 20>, 3>;
+
+    // Writes a catalogue whose rows are streamed in rather than held in memory. The
+    // rows of each pool and CR are counted up front, which fixes the layout, and are
+    // then appended in CR order, in any number of pieces and with the pools
+    // interleaved. Every column is written in place at its offset, a chunk of rows at
+    // a time, so the writer only buffers one chunk per pool. Throws
+    // std::runtime_error if the file cannot be written or the rows do not match the
+    // counts.
+    class CatalogWriter {
+    public:
+        using Sizes = std::array<std::array<std::size_t, 20>, 3>;
+        CatalogWriter(std::string const& path, Sizes const& sizes);
+
+        void append(EncType type, std::span<const MonsterStats> rows);
+        void finish();
+
+    private:
+        void flush(int p);
+
+        std::string path;
+        std::ofstream out;
+        std::array<std::size_t, 3> offset {}, total {}, written {};
+        std::array<CatalogLayout, 3> layout {};
+        std::array<std::vector<MonsterStats>, 3> pending;
+    };
+
+    // Writes a catalogue of rows in memory. Throws std::runtime_error if the file
+    // cannot be written.
+    void write_catalog(std::string const& path, CatalogRows const& rows);
+    // Writes the catalogue made of the given tables, e.g. the built-in active_catalog
+    void write_catalog(std::string const& path, CatalogTables const& tables);
+}
+
+#endif // CATALOG_H
@@ -19,17 +19,13 @@
 
 namespace dndSim{
 
-void character::setStats(std::vector<unsigned short int> statVec = {10,10,10,10,10,10}) {
-    this->stats = {10,10,10,10,10,10};
-    for( unsigned short int i = 0; i < stats.size(); i++ ){
-        this->stats[i] = statVec[i];
-    }
+void character::setStats(StatBlock statBlock) {
+    this->stats = statBlock;
 }
 
 void character::setSaves(std::vector<unsigned short int> saveNames) {
-    this->saves = {0,0,0,0,0,0};
     for( unsigned short int k = 0 ; k < 6 ; ++k ){
-        this->saves[k] = ( stats[k] / 2 ) - 5;
+        this->saves[k] = modifier( stats[k] );
     }
     for( auto saveName : saveNames ){
         this->saves[saveName] += profBonus;
@@ -37,11 +33,11 @@ void character::setSaves(std::vector<unsigned short int> saveNames) {
 }
 
 void character::setAC(unsigned short int baseAc, bool includeDex) {
-    this->ac = baseAc + unsigned( includeDex ) * (( stats[1] / 2 ) - 5);
+    this->ac = baseAc + int( includeDex ) * modifier( stats[1] );
 }
 
 void character::setProcBonus() {
-    this->profBonus = ( lvlCR / 4 ) + 2;
+    this->profBonus = proficiency( lvlCR );
 }
 
 void character::setSaveDC() {
@@ -59,40 +55,31 @@ character::character() {
     setSaveDC();
 }
 
-character::character(unsigned short int lvlCR, std::vector<unsigned short int> inputStats, bool causeSave, std::vector<unsigned short int> saveNames, unsigned short int atkStat, unsigned short int baseAc, bool includeDex) {
-    this->lvlCR = lvlCR;
-    setStats( inputStats );
-    setProcBonus();
-    this->atkStat = atkStat;
-    setSaves( saveNames );
-    setAC( baseAc, includeDex );
-    setAtkBonus();
-    this->causeSave = causeSave;
-    setSaveDC();
-}
-
-unsigned short int character::getLvl() const
-{
-    return this->lvlCR;
-}
+character::character(unsigned short int lvlCR, StatBlock inputStats, bool causeSave, std::initializer_list<unsigned short int> saveNames, unsigned short int atkStat, unsigned short int baseAc, bool includeDex)
+    : character(monster_stats(lvlCR, inputStats, causeSave, saveNames, atkStat, baseAc, includeDex)) {}
 
-std::vector<unsigned short int> character::getStats() const
-{
-    return this->stats;
-}
+character::character(MonsterStats const& m)
+    : lvlCR(m.lvlCR), stats(m.stats), saves(m.saves), atkStat(m.atkStat), profBonus(m.profBonus),
+      atkBonus(m.atkBonus), ac(m.ac), causeSave(m.causeSave), saveDC(m.saveDC) {}
 
-std::vector<unsigned short int> character::getSaves() const
-{
-    return this->saves;
-}
+constinit CatalogTables active_catalog = {&monster_tables, &spell_monster_tables, &non_spell_monster_tables};
 
-unsigned short int character::getProfBonus() const
+std::vector<npc> const& encounters(int lvlCR, EncType type)
 {
-    return this->profBonus;
-}
-
-unsigned short int character::getAC() const {
-    return this->ac;
+    static const auto pools = [] {
+        std::array<std::array<std::vector<npc>, 20>, 3> pools;
+        for (auto poolType : {EncType::any, EncType::spellcaster, EncType::regular}) {
+            for (int cr = 1; cr <= 20; ++cr) {
+                auto const& table = encounter_table(cr, poolType);
+                auto& pool = pools[static_cast<int>(poolType)][cr - 1];
+                pool.reserve(table.size());
+                for (std::size_t i = 0; i < table.size(); ++i) pool.emplace_back(table.stats(i));
+            }
+        }
+        return pools;
+    }();
+    encounter_table(lvlCR, type); // validates the arguments
+    return pools[static_cast<int>(type)][lvlCR - 1];
 }
 
 bool character::attack(character const& enemy, RNG::RNG_t& rng) const
@@ -154,32 +141,23 @@ bool character::save(unsigned short int saveStat, unsigned short int saveDC, RNG
 }
 
 void character::setAtkBonus() {
-    this->atkBonus = (short)(stats[atkStat]/2) - 5;
+    this->atkBonus = modifier( stats[atkStat] );
 }
 
-void barbarian::initializeLvlStats() {
-    lvlStats = {
-        {16,14,14,8,12,10}, {18,14,14,8,12,10}, {18,14,16,8,12,10},
-        {20,14,16,8,12,10}, {20,14,18,8,12,10}, {20,14,20,8,12,10}, {20,14,20,8,12,10}
-    };
-}
 barbarian::barbarian() : character(1, {16,14,14,8,12,10}, false, {0,2}, 0, 10, true), rage(2) {
-    initializeLvlStats();
     setStats(lvlStats[0]);
     setProcBonus();
     setSaves({0,2});
     setAtkBonus();
 }
-barbarian::barbarian(unsigned short int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {0,2},0, 10, true), rage(2) {
-    initializeLvlStats();
+barbarian::barbarian(unsigned short int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {0,2},0, 10, true), rage(2) {
     rage += unsigned(lvlCR > 8) + unsigned(lvlCR > 15);
     setStats(lvlStats[unsigned(lvlCR) / 4 + unsigned(lvlCR > 18)]);
     setProcBonus();
     setSaves({0,2});
     setAtkBonus();
 }
-barbarian::barbarian(int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {0,2}, 0, 10, true), rage(2) {
-    initializeLvlStats();
+barbarian::barbarian(int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {0,2}, 0, 10, true), rage(2) {
     rage += unsigned(lvlCR > 8) + unsigned(lvlCR > 15);
     setStats(lvlStats[unsigned(lvlCR) / 4 + unsigned(lvlCR > 18)]);
     setProcBonus();
@@ -187,7 +165,7 @@ barbarian::barbarian(int lvlCR, std::vector<unsigned short int> stats) : charact
     setAtkBonus();
 }
 void barbarian::setAC(unsigned short int baseAc, bool includeDex) {
-    this->ac = baseAc + (unsigned short)(includeDex)*((stats[1] / 2) - 5) + ((stats[2] / 2) - 5);
+    this->ac = baseAc + int(includeDex)*((stats[1] / 2) - 5) + ((stats[2] / 2) - 5);
 }
 bool barbarian::attack(character const& enemy, RNG::RNG_t& rng) const
 {
@@ -203,14 +181,7 @@ bool barbarian::save(unsigned short int saveStat, unsigned short int saveDC, RNG
     return (RNG::barb_roll1d20(rng) + saves[saveStat] + rage >= saveDC);
 }
 
-void cleric::initializeLvlStats() {
-    lvlStats = {
-        {10,14,12,8,16,14}, {10,14,12,8,18,14}, {10,14,12,8,20,14},
-        {10,16,12,8,20,14}, {10,16,12,8,20,14}, {10,16,12,8,20,14}, {10,16,12,8,20,14}
-    };
-}
 cleric::cleric() : character(1, {10,14,12,8,16,14}, true, {4,5}, 4, 10, true), mediumArmorMaster(false) {
-    initializeLvlStats();
     setStats(lvlStats[0]);
     setSaves({4,5});
     setProcBonus();
@@ -218,8 +189,7 @@ cleric::cleric() : character(1, {10,14,12,8,16,14}, true, {4,5}, 4, 10, true), m
     setSaveDC();
     setAC();
 }
-cleric::cleric(unsigned short int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, true, {4,5}, 4, 10, true), mediumArmorMaster(false) {
-    initializeLvlStats();
+cleric::cleric(unsigned short int lvlCR, StatBlock stats) : character(lvlCR, stats, true, {4,5}, 4, 10, true), mediumArmorMaster(false) {
     setStats(lvlStats[unsigned(lvlCR / 4) + unsigned(lvlCR > 18)]);
     mediumArmorMaster = lvlCR > 15;
     setProcBonus();
@@ -228,8 +198,7 @@ cleric::cleric(unsigned short int lvlCR, std::vector<unsigned short int> stats)
     setSaveDC();
     setAC();
 }
-cleric::cleric(int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, true, {4,5}, 4, 10, true), mediumArmorMaster(false) {
-    initializeLvlStats();
+cleric::cleric(int lvlCR, StatBlock stats) : character(lvlCR, stats, true, {4,5}, 4, 10, true), mediumArmorMaster(false) {
     setStats(lvlStats[unsigned(lvlCR / 4) + unsigned(lvlCR > 18)]);
     mediumArmorMaster = lvlCR > 15;
     setProcBonus();
@@ -244,26 +213,18 @@ bool cleric::attack(character const& enemy, RNG::RNG_t& rng) const
 }
 
 void cleric::setAC(unsigned short int baseAc, bool includeDex) {
-    this->ac = baseAc + (unsigned short)(includeDex)*std::min(((stats[1] / 2) - 5), 2 + int(mediumArmorMaster));
+    this->ac = baseAc + int(includeDex)*std::min(((stats[1] / 2) - 5), 2 + int(mediumArmorMaster));
 }
 bool cleric::save(unsigned short int saveStat, unsigned short int saveDC, RNG::RNG_t& rng) const
 {
     return (RNG::cler_roll1d20(rng) + saves[saveStat] >= saveDC);
 }
 
-void rogue::initializeLvlStats() {
-    lvlStats = {
-        {8,16,12,14,14,10}, {8,18,12,14,14,10}, {8,20,12,14,14,10},
-        {8,20,12,14,14,10}, {8,20,12,14,14,10}, {8,20,12,14,14,10}, {8,20,12,14,14,10}
-    };
-}
 rogue::rogue() : character(1, {8,16,12,14,14,10}, false, {1,3}, 1, 11, true) {
-    initializeLvlStats();
     setStats(lvlStats[0]);
     setAC(11);
 }
-rogue::rogue(unsigned short int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {1,3}, 1, 11, true) {
-    initializeLvlStats();
+rogue::rogue(unsigned short int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {1,3}, 1, 11, true) {
     setStats(lvlStats[unsigned(lvlCR / 4) + unsigned(lvlCR > 18)]);
     setProcBonus();
     setAtkBonus();
@@ -271,8 +232,7 @@ rogue::rogue(unsigned short int lvlCR, std::vector<unsigned short int> stats) :
     setSaves({1,3});
     if(lvlCR > 14) setSaves({1,3,4});
 }
-rogue::rogue(int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {1,3}, 1, 11, true) {
-    initializeLvlStats();
+rogue::rogue(int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {1,3}, 1, 11, true) {
     setStats(lvlStats[unsigned(lvlCR / 4) + unsigned(lvlCR > 18)]);
     setProcBonus();
     setAtkBonus();
@@ -290,14 +250,7 @@ bool rogue::save(unsigned short int saveStat, unsigned short int saveDC, RNG::RN
     return (RNG::rog_roll1d20(rng) + saves[saveStat] >= saveDC);
 }
 
-void wizard::initializeLvlStats() {
-    lvlStats = {
-        {8,14,10,16,14,12}, {8,14,10,18,14,12}, {8,14,10,20,14,12},
-        {8,16,10,20,14,12}, {8,18,10,20,14,12}, {8,20,10,20,14,12}, {8,20,10,20,14,12}
-    };
-}
 wizard::wizard() : character(1, {8,14,10,16,14,12}, false, {3,4}, 3, 10, true) {
-    initializeLvlStats();
     setStats(lvlStats[0]);
     setProcBonus();
     setAtkBonus();
@@ -305,8 +258,7 @@ wizard::wizard() : character(1, {8,14,10,16,14,12}, false, {3,4}, 3, 10, true) {
     setSaveDC();
     setAC(10);
 }
-wizard::wizard(unsigned short int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {3,4}, 3, 10, true) {
-    initializeLvlStats();
+wizard::wizard(unsigned short int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {3,4}, 3, 10, true) {
     setStats(lvlStats[(unsigned short)(lvlCR / 4) + (unsigned short)(lvlCR > 18)]);
     setProcBonus();
     setAtkBonus();
@@ -314,8 +266,7 @@ wizard::wizard(unsigned short int lvlCR, std::vector<unsigned short int> stats)
     setSaveDC();
     setAC(10 + 3 * unsigned(lvlCR > 1));
 }
-wizard::wizard(int lvlCR, std::vector<unsigned short int> stats) : character(lvlCR, stats, false, {3,4}, 3, 10, true) {
-    initializeLvlStats();
+wizard::wizard(int lvlCR, StatBlock stats) : character(lvlCR, stats, false, {3,4}, 3, 10, true) {
     setStats(lvlStats[(unsigned short)(lvlCR / 4) + (unsigned short)(lvlCR > 18)]);
     setProcBonus();
     setAtkBonus();
@@ -351,58 +302,19 @@ struct StaticInit {
 };
 static StaticInit staticInit;
 
-bool attack_barbarian(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng)
-{
-    return npc.attack(barbarian_premade[lvl], rng);
-}
-
-bool attack_cleric(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng)
+double probability(Die die, int threshold)
 {
-    return npc.attack(cleric_premade[lvl], rng);
+    const double p = std::clamp(21 - threshold, 0, 20) / 20.;
+    switch (die) {
+        case Die::d20dl: return 1. - (1. - p) * (1. - p);
+        case Die::d20dh: return p * p;
+        default: return p;
+    }
 }
 
-bool attack_rogue(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng)
+double probability(Check const& check)
 {
-    return npc.attack(rogue_premade[lvl], rng);
+    const double p = probability(check.die, check.threshold);
+    return check.onSave ? 1. - p : p;
 }
-
-    bool attack_wizard(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng)
-    {
-        return npc.attack(wizard_premade[lvl], rng);
-    }
-
-    extern std::vector<std::vector<std::shared_ptr<dndSim::npc>>> monsters;
-    extern std::vector<std::vector<std::shared_ptr<dndSim::npc>>> spell_monsters;
-    extern std::vector<std::vector<std::shared_ptr<dndSim::npc>>> non_spell_monsters;
-
-    dndSim::npc const& random_encounter_any(unsigned short int lvlCR, RNG::RNG_t& rng)
-    {
-        auto nr = RNG::genRNG(monsters[lvlCR - 1].size(), rng);
-        return *monsters[lvlCR-1][nr];
-    }
-
-    dndSim::npc const& random_encounter_spellcaster(unsigned short int lvlCR, RNG::RNG_t& rng)
-    {
-        auto nr = RNG::genRNG(spell_monsters[lvlCR - 1].size(), rng);
-        return *spell_monsters[lvlCR-1][nr];
-    }
-
-    dndSim::npc const& random_encounter_regular(unsigned short int lvlCR, RNG::RNG_t& rng)
-    {
-        auto nr = RNG::genRNG(non_spell_monsters[lvlCR - 1].size(), rng);
-        return *non_spell_monsters[lvlCR-1][nr];
-    }
-
-    dndSim::npc const& random_encounter(int lvlCR, EncType type, RNG::RNG_t& rng)
-    {
-        if (lvlCR < 1 || lvlCR > 20) throw std::invalid_argument("Currently only CRs of integers 1 through 20 are implemented.");
-        if (type == EncType::any)
-            return random_encounter_any(lvlCR, rng);
-        if (type == EncType::spellcaster)
-            return random_encounter_spellcaster(lvlCR, rng);
-        if (type == EncType::regular)
-            return random_encounter_regular(lvlCR, rng);
-
-        throw std::invalid_argument("Enemy type must be 'any', 'spellcaster', or 'regular'.");
-    }
 }
@@ -19,16 +19,29 @@
 #define DND_SIM_H
 
 #include <string>
-#include <map>
+#include <string_view>
 #include <algorithm>
 #include <memory>
+#include <initializer_list>
+#include <array>
+#include <cstdint>
+#include <span>
 #include <stdexcept>
-#include <iostream>
+#include <variant>
 #include "rng.h"
 
 namespace dndSim{
 
-    const std::map<std::string,unsigned short int> statNames = {{"str",0}, {"dex",1}, {"con",2}, {"int",3}, {"wis",4}, {"cha",5}};
+    // Constant rather than a map, so that including the header adds no static constructor
+    constexpr std::array<std::string_view, 6> statNames = {"str", "dex", "con", "int", "wis", "cha"};
+
+    // Index of a stat in statNames, -1 if name is none of them
+    constexpr int stat_index(std::string_view name)
+    {
+        for (std::size_t k = 0; k < statNames.size(); ++k)
+            if (statNames[k] == name) return k;
+        return -1;
+    }
 
     class character;
     class barbarian;
@@ -37,32 +50,78 @@ namespace dndSim{
     class wizard;
     using npc = character;
 
+    // The six ability scores (or saving throw bonuses) of a combatant, in the order of statNames
+    using StatBlock = std::array<std::int8_t, 6>;
+
+    // Ability modifier of a score, and proficiency bonus at a level or CR
+    constexpr int modifier(int score) { return score / 2 - 5; }
+    constexpr int proficiency(int lvlCR) { return lvlCR / 4 + 2; }
+
+    // Everything a character is made of, as a plain aggregate, so that the monster
+    // catalogue can be evaluated at compile time and live in read-only data
+    struct MonsterStats {
+        unsigned char lvlCR = 1;
+        StatBlock stats {};
+        StatBlock saves {};
+        unsigned char atkStat = 0;
+        std::int8_t profBonus = 2;
+        std::int8_t atkBonus = 0;
+        std::int8_t ac = 10;
+        bool causeSave = false;
+        std::int8_t saveDC = 10;
+    };
+
+    // Derives the stats of a character the way its constructor does
+    constexpr MonsterStats monster_stats(unsigned short int lvlCR, StatBlock stats = {10,10,10,10,10,10}, bool causeSave = false, std::initializer_list<unsigned short int> saveNames = {}, unsigned short int atkStat = 0, unsigned short int baseAc = 10, bool includeDex = false)
+    {
+        MonsterStats m;
+        m.lvlCR = lvlCR;
+        m.stats = stats;
+        m.profBonus = proficiency(lvlCR);
+        m.atkStat = atkStat;
+        for (unsigned short int k = 0; k < 6; ++k) m.saves[k] = modifier(stats[k]);
+        for (auto saveName : saveNames) m.saves[saveName] += m.profBonus;
+        m.ac = baseAc + int(includeDex) * modifier(stats[1]);
+        m.atkBonus = modifier(stats[atkStat]);
+        m.causeSave = causeSave;
+        m.saveDC = 8 + m.atkBonus + m.profBonus;
+        return m;
+    }
+
     class character {
     protected:
-        unsigned short int lvlCR = 0;
-        std::vector<unsigned short int> stats;
-        std::vector<unsigned short int> saves;
-        unsigned short int atkStat = 0;
+        // Stored compactly and signed, so that the stat block is trivially copyable,
+        // needs no allocation and low scores give negative saves
+        unsigned char lvlCR = 0;
+        StatBlock stats {};
+        StatBlock saves {};
+        unsigned char atkStat = 0;
         void setAtkBonus();
-        unsigned short int profBonus = 2;
-        short int atkBonus = 0;
-        unsigned short int ac = 10;
+        std::int8_t profBonus = 2;
+        std::int8_t atkBonus = 0;
+        std::int8_t ac = 10;
         bool causeSave = false;
-        unsigned short int saveDC = 10;
-        void setStats(std::vector<unsigned short int> stats);
+        std::int8_t saveDC = 10;
+        void setStats(StatBlock stats = {10,10,10,10,10,10});
         void setSaves(std::vector<unsigned short int> saveNames = {});
         virtual void setAC(unsigned short int baseAc = 10, bool includeDex = true);
         void setProcBonus();
         void setSaveDC();
     public:
         character();
-        character(unsigned short int lvlCR, std::vector<unsigned short int> stats = {10,10,10,10,10,10}, bool causeSave = false, std::vector<unsigned short int> saveNames = {}, unsigned short int atkStat = 0, unsigned short int baseAc = 10, bool includeDex = false);
+        character(unsigned short int lvlCR, StatBlock stats = {10,10,10,10,10,10}, bool causeSave = false, std::initializer_list<unsigned short int> saveNames = {}, unsigned short int atkStat = 0, unsigned short int baseAc = 10, bool includeDex = false);
+        explicit character(MonsterStats const& m);
         virtual ~character() = default;
-        unsigned short int getLvl() const;
-        std::vector<unsigned short int> getStats() const;
-        std::vector<unsigned short int> getSaves() const;
-        unsigned short int getProfBonus() const;
-        unsigned short int getAC() const;
+        unsigned short int getLvl() const { return lvlCR; }
+        std::span<const std::int8_t, 6> getStats() const { return stats; }
+        std::span<const std::int8_t, 6> getSaves() const { return saves; }
+        int getSave(unsigned short int saveStat) const { return saves[saveStat]; }
+        int getProfBonus() const { return profBonus; }
+        int getAtkBonus() const { return atkBonus; }
+        unsigned short int getAtkStat() const { return atkStat; }
+        int getSaveDC() const { return saveDC; }
+        bool causesSave() const { return causeSave; }
+        int getAC() const { return ac; }
         virtual bool attack(character const& enemy, RNG::RNG_t& rng) const;
         bool attack(barbarian const& enemy, RNG::RNG_t& rng);
         bool attack(cleric const& enemy, RNG::RNG_t& rng);
@@ -72,75 +131,431 @@ namespace dndSim{
     };
 
     class barbarian : public character {
-        std::vector<std::vector<unsigned short int>> lvlStats;
+        static constexpr std::array<StatBlock, 7> lvlStats = {{
+            {16,14,14,8,12,10}, {18,14,14,8,12,10}, {18,14,16,8,12,10},
+            {20,14,16,8,12,10}, {20,14,18,8,12,10}, {20,14,20,8,12,10}, {20,14,20,8,12,10}
+        }};
         unsigned short int rage;
     public:
         barbarian();
-        barbarian(unsigned short int lvlCR, std::vector<unsigned short int> stats = {16,14,14,8,12,10});
-        barbarian(int lvlCR, std::vector<unsigned short int> stats = {16,14,14,8,12,10});
+        barbarian(unsigned short int lvlCR, StatBlock stats = {16,14,14,8,12,10});
+        barbarian(int lvlCR, StatBlock stats = {16,14,14,8,12,10});
         bool attack(character const& enemy, RNG::RNG_t& rng) const override;
         bool save(unsigned short int saveStat, unsigned short int saveDC, RNG::RNG_t& rng) const override;
+        unsigned short int getRage() const { return rage; }
 
     protected:
         void setAC(unsigned short int baseAc = 10, bool includeDex = true) override;
-    private:
-        void initializeLvlStats();
     };
 
     class cleric : public character {
-        std::vector<std::vector<unsigned short int>> lvlStats;
+        static constexpr std::array<StatBlock, 7> lvlStats = {{
+            {10,14,12,8,16,14}, {10,14,12,8,18,14}, {10,14,12,8,20,14},
+            {10,16,12,8,20,14}, {10,16,12,8,20,14}, {10,16,12,8,20,14}, {10,16,12,8,20,14}
+        }};
         bool mediumArmorMaster;
     public:
         cleric();
-        cleric(unsigned short int lvlCR, std::vector<unsigned short int> stats = {10,14,12,8,16,14});
-        cleric(int lvlCR, std::vector<unsigned short int> stats = {10,14,12,8,16,14});
+        cleric(unsigned short int lvlCR, StatBlock stats = {10,14,12,8,16,14});
+        cleric(int lvlCR, StatBlock stats = {10,14,12,8,16,14});
         bool attack(character const& enemy, RNG::RNG_t& rng) const override;
         bool save(unsigned short int saveStat, unsigned short int saveDC, RNG::RNG_t& rng) const override;
 
     protected:
         void setAC(unsigned short int baseAc = 13, bool includeDex = true) override;
-    private:
-        void initializeLvlStats(); // Helper function for lvlStats initialization
     };
 
     class rogue : public character {
-        std::vector<std::vector<unsigned short int>> lvlStats;
+        static constexpr std::array<StatBlock, 7> lvlStats = {{
+            {8,16,12,14,14,10}, {8,18,12,14,14,10}, {8,20,12,14,14,10},
+            {8,20,12,14,14,10}, {8,20,12,14,14,10}, {8,20,12,14,14,10}, {8,20,12,14,14,10}
+        }};
     public:
         rogue();
-        rogue(unsigned short int lvlCR, std::vector<unsigned short int> stats = {8,16,12,14,14,10});
-        rogue(int lvlCR, std::vector<unsigned short int> stats = {8,16,12,14,14,10});
+        rogue(unsigned short int lvlCR, StatBlock stats = {8,16,12,14,14,10});
+        rogue(int lvlCR, StatBlock stats = {8,16,12,14,14,10});
         bool attack(character const& enemy, RNG::RNG_t& rng) const override;
         bool save(unsigned short int saveStat, unsigned short int saveDC, RNG::RNG_t& rng) const override;
 
-    private:
-        void initializeLvlStats();
     };
 
     class wizard : public character {
-        std::vector<std::vector<unsigned short int>> lvlStats;
+        static constexpr std::array<StatBlock, 7> lvlStats = {{
+            {8,14,10,16,14,12}, {8,14,10,18,14,12}, {8,14,10,20,14,12},
+            {8,16,10,20,14,12}, {8,18,10,20,14,12}, {8,20,10,20,14,12}, {8,20,10,20,14,12}
+        }};
     public:
         wizard();
-        wizard(unsigned short int lvlCR, std::vector<unsigned short int> stats = {8,14,10,16,14,12});
-        wizard(int lvlCR, std::vector<unsigned short int> stats = {8,14,10,16,14,12});
+        wizard(unsigned short int lvlCR, StatBlock stats = {8,14,10,16,14,12});
+        wizard(int lvlCR, StatBlock stats = {8,14,10,16,14,12});
         bool attack(character const& enemy, RNG::RNG_t& rng) const override;
         bool save(unsigned short int saveStat, unsigned short int saveDC, RNG::RNG_t& rng) const override;
 
-    private:
-        void initializeLvlStats();
     };
 
-    bool attack_barbarian(unsigned short int lvl, npc const& npc, RNG::RNG_t& rng);
-    bool attack_cleric(unsigned short int lvl, npc const& npc, RNG::RNG_t& rng);
-    bool attack_rogue(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng);
-    bool attack_wizard(unsigned short int lvl, dndSim::npc const& npc, RNG::RNG_t& rng);
-
     enum class EncType { any, spellcaster, regular, unknown };
-    npc const& random_encounter(int lvlCR, EncType type, RNG::RNG_t& rng);
+    enum class PCClass : unsigned char { barbarian, cleric, rogue, wizard };
+    constexpr unsigned int nPCClasses = 4;
 
     extern std::vector<barbarian> barbarian_premade;
     extern std::vector<cleric> cleric_premade;
     extern std::vector<rogue> rogue_premade;
     extern std::vector<wizard> wizard_premade;
+
+    // Calls f with the premade character of the given class and level
+    template<class F>
+    decltype(auto) with_premade(PCClass pcClass, unsigned short int lvl, F&& f)
+    {
+        switch (pcClass) {
+            case PCClass::barbarian: return f(barbarian_premade[lvl]);
+            case PCClass::cleric: return f(cleric_premade[lvl]);
+            case PCClass::rogue: return f(rogue_premade[lvl]);
+            default: return f(wizard_premade[lvl]);
+        }
+    }
+
+    class MonsterTable;
+
+    // One row of a MonsterTable. It reads like an npc to the checks below, but each
+    // getter is a load from a dense column rather than a pointer chase.
+    class monster {
+        MonsterTable const* table;
+        std::uint32_t i;
+    public:
+        monster(MonsterTable const& table, std::uint32_t i) : table(&table), i(i) {}
+        int getSave(unsigned short int saveStat) const;
+        int getProfBonus() const;
+        int getAtkBonus() const;
+        unsigned short int getAtkStat() const;
+        int getSaveDC() const;
+        bool causesSave() const;
+        int getAC() const;
+    };
+
+    // The monsters of an encounter pool, CR by CR, laid out at compile time as a
+    // structure of arrays: one contiguous column per attribute the checks read, and
+    // the rows themselves for building npc objects.
+    template<std::size_t N>
+    struct MonsterColumns {
+        std::array<MonsterStats, N> rows {};
+        std::array<std::int8_t, N> ac {};
+        std::array<std::array<std::int8_t, N>, 6> saves {};
+        std::array<std::int8_t, N> atkBonus {};
+        std::array<std::int8_t, N> profBonus {};
+        std::array<std::int8_t, N> saveDC {};
+        std::array<unsigned char, N> atkStat {};
+        std::array<unsigned char, N> causeSave {};
+        std::array<std::uint32_t, 21> crOffset {}; // first row of each CR, crOffset[20] = N
+    };
+
+    template<std::size_t... N>
+        requires (sizeof...(N) == 20)
+    consteval MonsterColumns<(N + ...)> tabulate(std::array<MonsterStats, N> const&... pools)
+    {
+        MonsterColumns<(N + ...)> columns;
+        std::size_t i = 0, cr = 0;
+        auto append = [&](auto const& pool) {
+            columns.crOffset[cr++] = i;
+            for (MonsterStats const& m : pool) {
+                columns.rows[i] = m;
+                columns.ac[i] = m.ac;
+                for (std::size_t k = 0; k < 6; ++k) columns.saves[k][i] = m.saves[k];
+                columns.atkBonus[i] = m.atkBonus;
+                columns.profBonus[i] = m.profBonus;
+                columns.saveDC[i] = m.saveDC;
+                columns.atkStat[i] = m.atkStat;
+                columns.causeSave[i] = m.causeSave;
+                ++i;
+            }
+        };
+        (append(pools), ...);
+        columns.crOffset[20] = i;
+        return columns;
+    }
+
+    // The monsters of one encounter pool and CR: a view of their rows in the columns
+    // of the pool (a MonsterColumns, or a mapped catalogue), so that an encounter is
+    // drawn as an index and resolved from a few cache lines.
+    class MonsterTable {
+        friend class monster;
+        MonsterStats const* rows = nullptr;
+        std::int8_t const* ac = nullptr;
+        std::array<std::int8_t const*, 6> saves {};
+        std::int8_t const* atkBonus = nullptr;
+        std::int8_t const* profBonus = nullptr;
+        std::int8_t const* saveDC = nullptr;
+        unsigned char const* atkStat = nullptr;
+        unsigned char const* causeSave = nullptr;
+        std::size_t n = 0;
+    public:
+        constexpr MonsterTable() = default;
+        template<class Columns>
+        constexpr MonsterTable(Columns const& columns, int lvlCR)
+        {
+            const std::size_t first = columns.crOffset[lvlCR - 1];
+            rows = columns.rows.data() + first;
+            ac = columns.ac.data() + first;
+            for (std::size_t k = 0; k < 6; ++k) saves[k] = columns.saves[k].data() + first;
+            atkBonus = columns.atkBonus.data() + first;
+            profBonus = columns.profBonus.data() + first;
+            saveDC = columns.saveDC.data() + first;
+            atkStat = columns.atkStat.data() + first;
+            causeSave = columns.causeSave.data() + first;
+            n = columns.crOffset[lvlCR] - first;
+        }
+        std::size_t size() const { return n; }
+        monster operator[](std::size_t i) const { return {*this, static_cast<std::uint32_t>(i)}; }
+        MonsterStats const& stats(std::size_t i) const { return rows[i]; }
+        std::span<const MonsterStats> stats() const { return {rows, n}; }
+    };
+
+    template<class Columns>
+    constexpr std::array<MonsterTable, 20> tables(Columns const& columns)
+    {
+        std::array<MonsterTable, 20> result;
+        for (int lvlCR = 1; lvlCR <= 20; ++lvlCR) result[lvlCR - 1] = MonsterTable(columns, lvlCR);
+        return result;
+    }
+
+    inline int monster::getSave(unsigned short int saveStat) const { return table->saves[saveStat][i]; }
+    inline int monster::getProfBonus() const { return table->profBonus[i]; }
+    inline int monster::getAtkBonus() const { return table->atkBonus[i]; }
+    inline unsigned short int monster::getAtkStat() const { return table->atkStat[i]; }
+    inline int monster::getSaveDC() const { return table->saveDC[i]; }
+    inline bool monster::causesSave() const { return table->causeSave[i]; }
+    inline int monster::getAC() const { return table->ac[i]; }
+
+    // The monster catalogue: every monster, spellcasters only and non-spellcasters
+    // only, indexed by CR - 1. Constant-initialised, so it costs nothing at startup.
+    extern const std::array<MonsterTable, 20> monster_tables;
+    extern const std::array<MonsterTable, 20> spell_monster_tables;
+    extern const std::array<MonsterTable, 20> non_spell_monster_tables;
+
+    // The tables of the catalogue encounters are drawn from, indexed by EncType. They
+    // are the built-in ones unless use_catalog (catalog.h) installs a loaded catalogue,
+    // which has to happen before the first encounter is drawn.
+    using CatalogTables = std::array<std::array<MonsterTable, 20> const*, 3>;
+    extern CatalogTables active_catalog;
+
+    // Every attack and saving throw in the simulation is a threshold test on one die:
+    // 1d20, or 2d20 keeping the higher (dl) or lower (dh) roll. A Check holds that die
+    // and the threshold it has to reach; for attacks that force a saving throw, the
+    // attack lands when the defender's check fails.
+    enum class Die : unsigned char { d20, d20dl, d20dh };
+
+    struct Check {
+        int threshold;
+        Die die = Die::d20;
+        bool onSave = false;
+    };
+
+    // The checks behind the statically dispatched hot path below. They follow the
+    // same rules as the virtual members above, but are resolved on the static
+    // types of the combatants.
+    template<class Self>
+    Check save_check(Self const& self, unsigned short int saveStat, unsigned short int saveDC)
+    {
+        return {saveDC - self.getSave(saveStat)};
+    }
+
+    inline Check save_check(barbarian const& self, unsigned short int saveStat, unsigned short int saveDC)
+    {
+        return {saveDC - self.getSave(saveStat) - self.getRage()};
+    }
+
+    // Monsters and plain characters; the classes below override it
+    template<class Self, class Enemy>
+    Check attack_check(Self const& self, Enemy const& enemy)
+    {
+        if( self.causesSave() ){
+            Check check = save_check(enemy, self.getAtkStat(), self.getSaveDC());
+            check.onSave = true;
+            return check;
+        } else {
+            return {enemy.getAC() - self.getAtkBonus() - self.getProfBonus()};
+        }
+    }
+
+    template<class Enemy>
+    Check attack_check(barbarian const& self, Enemy const& enemy)
+    {
+        return {enemy.getAC() - self.getAtkBonus() - self.getProfBonus() - self.getRage(), self.getLvl() == 1 ? Die::d20 : Die::d20dl};
+    }
+
+    template<class Enemy>
+    Check attack_check(cleric const& self, Enemy const& enemy)
+    {
+        Check check = save_check(enemy, 4, self.getSaveDC());
+        check.onSave = true;
+        return check;
+    }
+
+    template<class Enemy>
+    Check attack_check(rogue const& self, Enemy const& enemy)
+    {
+        return {enemy.getAC() - self.getAtkBonus() - self.getProfBonus()};
+    }
+
+    template<class Enemy>
+    Check attack_check(wizard const& self, Enemy const& enemy)
+    {
+        return {enemy.getAC() - self.getAtkBonus() - self.getProfBonus()};
+    }
+
+    // Statically dispatched hot path, templated on the generator, so that the whole
+    // attack/save chain of a trial inlines into the calling loop for whichever
+    // engine it is instantiated with.
+    template<RNG::Generator G>
+    unsigned short int roll(Die die, G& rng)
+    {
+        switch (die) {
+            case Die::d20dl: return RNG::roll2d20dl(rng);
+            case Die::d20dh: return RNG::roll2d20dh(rng);
+            default: return RNG::roll1d20(rng);
+        }
+    }
+
+    template<RNG::Generator G>
+    bool resolve(Check const& check, G& rng)
+    {
+        return (roll(check.die, rng) >= check.threshold) != check.onSave;
+    }
+
+    template<class Self, RNG::Generator G>
+    bool save(Self const& self, unsigned short int saveStat, unsigned short int saveDC, G& rng)
+    {
+        return resolve(save_check(self, saveStat, saveDC), rng);
+    }
+
+    template<class Self, class Enemy, RNG::Generator G>
+    bool attack(Self const& self, Enemy const& enemy, G& rng)
+    {
+        return resolve(attack_check(self, enemy), rng);
+    }
+
+    // The closed set of combatants, for callers that only learn at runtime who
+    // fights whom. std::visit turns the dispatch into one jump table per call, and
+    // every pairing below it instantiates the statically dispatched attack above.
+    using combatant = std::variant<monster, npc const*, barbarian const*, cleric const*, rogue const*, wizard const*>;
+
+    template<class T> T const& unwrap(T const& self) { return self; }
+    template<class T> T const& unwrap(T const* self) { return *self; }
+
+    inline combatant premade(PCClass pcClass, unsigned short int lvl)
+    {
+        return with_premade(pcClass, lvl, [](auto const& pc) { return combatant(&pc); });
+    }
+
+    template<RNG::Generator G>
+    bool attack(combatant const& self, combatant const& enemy, G& rng)
+    {
+        return std::visit([&rng](auto const& s, auto const& e) { return attack(unwrap(s), unwrap(e), rng); }, self, enemy);
+    }
+
+    template<RNG::Generator G>
+    bool attack_barbarian(unsigned short int lvl, dndSim::npc const& npc, G& rng)
+    {
+        return attack(npc, barbarian_premade[lvl], rng);
+    }
+
+    template<RNG::Generator G>
+    bool attack_cleric(unsigned short int lvl, dndSim::npc const& npc, G& rng)
+    {
+        return attack(npc, cleric_premade[lvl], rng);
+    }
+
+    template<RNG::Generator G>
+    bool attack_rogue(unsigned short int lvl, dndSim::npc const& npc, G& rng)
+    {
+        return attack(npc, rogue_premade[lvl], rng);
+    }
+
+    template<RNG::Generator G>
+    bool attack_wizard(unsigned short int lvl, dndSim::npc const& npc, G& rng)
+    {
+        return attack(npc, wizard_premade[lvl], rng);
+    }
+
+    // The monsters random_encounter draws from, as npc objects for the object-oriented
+    // API. They are built from the catalogue on first use.
+    std::vector<npc> const& encounters(int lvlCR, EncType type);
+
+    template<RNG::Generator G>
+    dndSim::npc const& random_encounter_any(unsigned short int lvlCR, G& rng)
+    {
+        auto const& pool = encounters(lvlCR, EncType::any);
+        return pool[RNG::genRNG(pool.size(), rng)];
+    }
+
+    template<RNG::Generator G>
+    dndSim::npc const& random_encounter_spellcaster(unsigned short int lvlCR, G& rng)
+    {
+        auto const& pool = encounters(lvlCR, EncType::spellcaster);
+        return pool[RNG::genRNG(pool.size(), rng)];
+    }
+
+    template<RNG::Generator G>
+    dndSim::npc const& random_encounter_regular(unsigned short int lvlCR, G& rng)
+    {
+        auto const& pool = encounters(lvlCR, EncType::regular);
+        return pool[RNG::genRNG(pool.size(), rng)];
+    }
+
+    template<RNG::Generator G>
+    dndSim::npc const& random_encounter(int lvlCR, EncType type, G& rng)
+    {
+        if (lvlCR < 1 || lvlCR > 20) throw std::invalid_argument("Currently only CRs of integers 1 through 20 are implemented.");
+        if (type == EncType::any)
+            return random_encounter_any(lvlCR, rng);
+        if (type == EncType::spellcaster)
+            return random_encounter_spellcaster(lvlCR, rng);
+        if (type == EncType::regular)
+            return random_encounter_regular(lvlCR, rng);
+
+        throw std::invalid_argument("Enemy type must be 'any', 'spellcaster', or 'regular'.");
+    }
+
+    // The SoA counterparts of encounters and random_encounter: the encounter is drawn
+    // as an index into the table of its pool and CR.
+    inline MonsterTable const& encounter_table(int lvlCR, EncType type)
+    {
+        if (lvlCR < 1 || lvlCR > 20) throw std::invalid_argument("Currently only CRs of integers 1 through 20 are implemented.");
+        if (type == EncType::any || type == EncType::spellcaster || type == EncType::regular)
+            return (*active_catalog[static_cast<int>(type)])[lvlCR - 1];
+
+        throw std::invalid_argument("Enemy type must be 'any', 'spellcaster', or 'regular'.");
+    }
+
+    template<RNG::Generator G>
+    monster random_monster(int lvlCR, EncType type, G& rng)
+    {
+        auto const& table = encounter_table(lvlCR, type);
+        return table[RNG::genRNG(table.size(), rng)];
+    }
+
+    // Exact engine: the probability that a check succeeds, and the expected hit
+    // rates of a character against a random encounter, averaged over the monsters
+    // random_encounter draws from instead of sampled.
+    double probability(Die die, int threshold);
+    double probability(Check const& check);
+
+    template<class PC>
+    double exact_hit_rate(PC const& pc, int lvlCR, EncType type = EncType::any)
+    {
+        auto const& table = encounter_table(lvlCR, type);
+        double sum = 0.;
+        for (std::size_t i = 0; i < table.size(); ++i) sum += probability(attack_check(pc, table[i]));
+        return sum / table.size();
+    }
+
+    template<class PC>
+    double exact_def_rate(PC const& pc, int lvlCR, EncType type = EncType::any)
+    {
+        auto const& table = encounter_table(lvlCR, type);
+        double sum = 0.;
+        for (std::size_t i = 0; i < table.size(); ++i) sum += probability(attack_check(table[i], pc));
+        return sum / table.size();
+    }
 }
 
 #endif // DND_SIM_H
@@ -0,0 +1,389 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "importer.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+namespace dndSim{
+
+namespace {
+
+enum class Format { csv, json };
+
+// Rows of one CR in file order, per parsed range
+using Partition = std::array<std::vector<MonsterStats>, 20>;
+
+[[noreturn]] void malformed(std::string_view line, std::string const& what)
+{
+    throw std::runtime_error("Malformed stat block (" + what + "): " + std::string(line.substr(0, 200)));
+}
+
+std::string_view trim(std::string_view s)
+{
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '\r')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+    return s;
+}
+
+bool parseInt(std::string_view s, int& value)
+{
+    s = trim(s);
+    auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+    return ec == std::errc{} && end == s.data() + s.size();
+}
+
+// A stat given by index or by its name in statNames; -1 if it is neither
+int parseStat(std::string_view s)
+{
+    int value = -1;
+    if (parseInt(s, value)) return value;
+    return stat_index(trim(s));
+}
+
+bool parseBool(std::string_view s, bool& value)
+{
+    s = trim(s);
+    if (s == "true" || s == "1") value = true;
+    else if (s == "false" || s == "0") value = false;
+    else return false;
+    return true;
+}
+
+// The fields of a stat block, checked and turned into MonsterStats
+struct Block {
+    int cr = 0;
+    std::array<int, 6> stats {};
+    int nStats = 0;
+    std::array<int, 6> saves {};
+    int nSaves = 0;
+    int atkStat = -1;
+    int ac = -1;
+    bool causeSave = false;
+    bool hasName = false, hasCauseSave = false;
+
+    MonsterStats build(std::string_view line) const
+    {
+        if (!hasName) malformed(line, "no name");
+        if (cr < 1 || cr > 20) malformed(line, "CR must be 1 to 20");
+        if (nStats != 6) malformed(line, "needs six stats");
+        StatBlock block;
+        for (int k = 0; k < 6; ++k) {
+            if (stats[k] < 1 || stats[k] > 30) malformed(line, "stats must be 1 to 30");
+            block[k] = stats[k];
+        }
+        if (atkStat < 0 || atkStat >= 6) malformed(line, "bad attack stat");
+        if (ac < 0 || ac > 100) malformed(line, "bad AC");
+        if (!hasCauseSave) malformed(line, "no save-or-attack flag");
+        MonsterStats m = monster_stats(cr, block, causeSave, {}, atkStat, ac);
+        std::array<bool, 6> proficient {};
+        for (int s = 0; s < nSaves; ++s) {
+            if (saves[s] < 0 || saves[s] >= 6) malformed(line, "bad save proficiency");
+            if (proficient[saves[s]]) malformed(line, "repeated save proficiency");
+            proficient[saves[s]] = true;
+            m.saves[saves[s]] += m.profBonus;
+        }
+        return m;
+    }
+};
+
+// Whether the first line of a CSV file is a header, "name,cr,..."
+bool isCsvHeader(std::string_view line)
+{
+    const std::size_t comma = line.find(',');
+    if (comma == std::string_view::npos) return trim(line) == "name";
+    const std::string_view rest = line.substr(comma + 1);
+    return trim(line.substr(0, comma)) == "name" && trim(rest.substr(0, rest.find(','))) == "cr";
+}
+
+// name,cr,str,dex,con,int,wis,cha,saves,atkStat,ac,causeSave
+bool parseCsv(std::string_view line, MonsterStats& m)
+{
+    std::string_view fields[12];
+    std::size_t nFields = 0;
+    std::size_t pos = 0;
+    if (!line.empty() && line.front() == '"') {
+        const std::size_t close = line.find('"', 1);
+        if (close == std::string_view::npos) malformed(line, "unterminated name");
+        fields[nFields++] = line.substr(1, close - 1);
+        pos = line.find(',', close);
+        pos = pos == std::string_view::npos ? line.size() : pos + 1;
+    }
+    while (nFields < 12 && pos <= line.size()) {
+        const std::size_t comma = std::min(line.find(',', pos), line.size());
+        fields[nFields++] = line.substr(pos, comma - pos);
+        pos = comma + 1;
+    }
+    if (nFields == 12 && pos <= line.size()) malformed(line, "too many fields");
+    if (nFields != 12) malformed(line, "expected 12 fields");
+
+    Block b;
+    b.hasName = !trim(fields[0]).empty();
+    if (!parseInt(fields[1], b.cr)) malformed(line, "bad CR");
+    for (int k = 0; k < 6; ++k) {
+        if (!parseInt(fields[2 + k], b.stats[k])) malformed(line, "bad stat");
+    }
+    b.nStats = 6;
+    std::string_view saves = fields[8];
+    while (!(saves = trim(saves)).empty()) {
+        const std::size_t end = std::min(saves.find_first_of(" ;|"), saves.size());
+        if (b.nSaves == 6) malformed(line, "too many saves");
+        b.saves[b.nSaves++] = parseStat(saves.substr(0, end));
+        saves.remove_prefix(std::min(end + 1, saves.size()));
+    }
+    b.atkStat = parseStat(fields[9]);
+    if (!parseInt(fields[10], b.ac)) malformed(line, "bad AC");
+    b.hasCauseSave = parseBool(fields[11], b.causeSave);
+    m = b.build(line);
+    return true;
+}
+
+// Minimal reader for one flat JSON object per line
+class JsonLine {
+    std::string_view line;
+    std::size_t pos = 0;
+public:
+    explicit JsonLine(std::string_view line) : line(line) {}
+    void skipSpace() { while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r')) ++pos; }
+    bool consume(char c) { skipSpace(); if (pos < line.size() && line[pos] == c) { ++pos; return true; } return false; }
+    void expect(char c) { if (!consume(c)) malformed(line, std::string("expected '") + c + "'"); }
+    bool atEnd() { skipSpace(); return pos == line.size(); }
+    std::string_view string()
+    {
+        expect('"');
+        const std::size_t start = pos;
+        while (pos < line.size() && line[pos] != '"') pos += line[pos] == '\\' ? 2 : 1;
+        if (pos >= line.size()) malformed(line, "unterminated string");
+        return line.substr(start, pos++ - start);
+    }
+    // A number, bare word (true, false, null) or string, as text
+    std::string_view scalar()
+    {
+        skipSpace();
+        if (pos < line.size() && line[pos] == '"') return string();
+        const std::size_t start = pos;
+        while (pos < line.size() && line[pos] != ',' && line[pos] != ']' && line[pos] != '}' && line[pos] != ' ') ++pos;
+        if (start == pos) malformed(line, "expected a value");
+        return line.substr(start, pos - start);
+    }
+    template<class F>
+    void array(F&& element)
+    {
+        expect('[');
+        if (consume(']')) return;
+        do element(scalar()); while (consume(','));
+        expect(']');
+    }
+    std::string_view text() const { return line; }
+};
+
+bool parseJson(std::string_view line, MonsterStats& m)
+{
+    line = trim(line);
+    if (line.empty() || line == "[" || line == "]") return false;
+    if (line.back() == ',') line.remove_suffix(1);
+    if (line.front() == '[') line.remove_prefix(1);
+    if (!line.empty() && line.back() == ']') line.remove_suffix(1);
+
+    JsonLine json(line);
+    Block b;
+    json.expect('{');
+    if (!json.consume('}')) {
+        do {
+            const std::string_view key = json.string();
+            json.expect(':');
+            if (key == "name") {
+                json.string();
+                b.hasName = true;
+            } else if (key == "stats") {
+                json.array([&](std::string_view v) {
+                    if (b.nStats == 6 || !parseInt(v, b.stats[b.nStats++])) malformed(line, "bad stats");
+                });
+            } else if (key == "saves") {
+                json.array([&](std::string_view v) {
+                    if (b.nSaves == 6) malformed(line, "too many saves");
+                    b.saves[b.nSaves++] = parseStat(v);
+                });
+            } else if (key == "cr") {
+                if (!parseInt(json.scalar(), b.cr)) malformed(line, "bad CR");
+            } else if (key == "atkStat") {
+                b.atkStat = parseStat(json.scalar());
+            } else if (key == "ac") {
+                if (!parseInt(json.scalar(), b.ac)) malformed(line, "bad AC");
+            } else if (key == "causeSave") {
+                b.hasCauseSave = parseBool(json.scalar(), b.causeSave);
+            } else {
+                json.skipSpace();
+                if (json.consume('[')) { json.array([](std::string_view) {}); } else json.scalar();
+            }
+        } while (json.consume(','));
+        json.expect('}');
+    }
+    if (!json.atEnd()) malformed(line, "trailing characters");
+    m = b.build(line);
+    return true;
+}
+
+void parseRange(std::string_view text, Format format, Partition& out)
+{
+    while (!text.empty()) {
+        const std::size_t end = std::min(text.find('\n'), text.size());
+        const std::string_view line = text.substr(0, end);
+        text.remove_prefix(std::min(end + 1, text.size()));
+        if (trim(line).empty()) continue;
+        MonsterStats m;
+        if (format == Format::csv ? parseCsv(line, m) : parseJson(line, m))
+            out[m.lvlCR - 1].push_back(m);
+    }
+}
+
+}
+
+ImportReport import_catalog(std::string const& input, std::string const& output, unsigned int nThread)
+{
+    std::ifstream in(input, std::ios::binary);
+    if (!in) throw std::runtime_error("Cannot open " + input);
+    nThread = std::max(nThread, 1u);
+
+    // Blocks are read ahead while the previous one is parsed
+    constexpr std::size_t blockSize = 16 << 20;
+    auto readBlock = [&in]() {
+        std::string block(blockSize, '\0');
+        in.read(block.data(), blockSize);
+        block.resize(in.gcount());
+        return block;
+    };
+
+    // The rows of each CR are spilled to a file of their own next to the output as
+    // they are parsed, so memory is bounded by the blocks rather than the rows
+    struct Spill {
+        std::array<std::string, 20> paths;
+        std::array<std::ofstream, 20> files;
+        explicit Spill(std::string const& output)
+        {
+            for (int cr = 0; cr < 20; ++cr) {
+                paths[cr] = output + ".cr" + std::to_string(cr + 1) + ".part";
+                files[cr].open(paths[cr], std::ios::binary);
+                if (!files[cr]) throw std::runtime_error("Cannot write " + paths[cr]);
+            }
+        }
+        ~Spill()
+        {
+            for (int cr = 0; cr < 20; ++cr) {
+                files[cr].close();
+                std::remove(paths[cr].c_str());
+            }
+        }
+    } spill(output);
+
+    ImportReport report;
+    std::array<std::size_t, 20> nAny {}, nSpell {};
+    std::vector<Partition> parts(nThread);
+    std::optional<Format> format;
+    std::string text;
+    auto next = std::async(std::launch::async, readBlock);
+    for (bool last = false; !last;) {
+        std::string block = next.get();
+        last = block.empty();
+        report.bytes += block.size();
+        if (!last) next = std::async(std::launch::async, readBlock);
+        text += block;
+
+        // The format is detected from the first character, and a CSV header can only be
+        // the first line
+        if (!format) {
+            const std::size_t first = text.find_first_not_of(" \t\r\n");
+            const std::size_t lineEnd = first == std::string::npos ? first : text.find('\n', first);
+            if (lineEnd == std::string::npos && !(last && first != std::string::npos)) continue;
+            format = text[first] == '{' || text[first] == '[' ? Format::json : Format::csv;
+            const std::string_view line = std::string_view(text).substr(first, lineEnd - first);
+            if (*format == Format::csv && isCsvHeader(line)) text.erase(0, std::min(lineEnd, text.size() - 1) + 1);
+        }
+        const std::size_t end = last ? text.size() : text.rfind('\n') + 1;
+        if (end == 0 && !last) continue; // a line longer than a block
+
+        // Split the complete lines into one range per thread at line ends
+        std::vector<std::string_view> ranges;
+        const std::string_view lines(text.data(), end);
+        for (std::size_t begin = 0, t = 0; begin < lines.size(); ++t) {
+            std::size_t stop = t + 1 == nThread ? lines.size() : std::max(begin, lines.size() * (t + 1) / nThread);
+            stop = std::min(lines.find('\n', stop), lines.size() - 1) + 1;
+            ranges.push_back(lines.substr(begin, stop - begin));
+            begin = stop;
+        }
+        std::vector<std::future<void>> tasks;
+        for (std::size_t t = 0; t < ranges.size(); ++t)
+            tasks.push_back(std::async(std::launch::async, parseRange, ranges[t], *format, std::ref(parts[t])));
+        for (auto& task : tasks) task.get();
+        for (std::size_t t = 0; t < ranges.size(); ++t) {
+            for (int cr = 0; cr < 20; ++cr) {
+                auto& rows = parts[t][cr];
+                spill.files[cr].write(reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(MonsterStats));
+                nAny[cr] += rows.size();
+                nSpell[cr] += std::count_if(rows.begin(), rows.end(), [](MonsterStats const& m) { return m.causeSave; });
+                rows.clear();
+            }
+        }
+        text.erase(0, end);
+    }
+
+    // The spellcaster and regular pools are the save-forcing and the attacking
+    // monsters of each CR, in the order of the any pool
+    CatalogWriter::Sizes sizes;
+    for (int cr = 0; cr < 20; ++cr) {
+        spill.files[cr].close();
+        if (!spill.files[cr]) throw std::runtime_error("Cannot write " + spill.paths[cr]);
+        if (nAny[cr] == 0) throw std::runtime_error(input + " has no monsters of CR " + std::to_string(cr + 1));
+        // The loader, like the samplers, needs every pool of every CR to have monsters
+        if (nSpell[cr] == 0 || nSpell[cr] == nAny[cr])
+            throw std::runtime_error(input + " has no " + (nSpell[cr] == 0 ? "save-forcing (spellcaster)" : "attacking (regular)")
+                                     + " monsters of CR " + std::to_string(cr + 1));
+        report.rows += nAny[cr];
+        sizes[static_cast<int>(EncType::any)][cr] = nAny[cr];
+        sizes[static_cast<int>(EncType::spellcaster)][cr] = nSpell[cr];
+        sizes[static_cast<int>(EncType::regular)][cr] = nAny[cr] - nSpell[cr];
+    }
+    CatalogWriter writer(output, sizes);
+    std::vector<MonsterStats> rows(1 << 16), spell, regular;
+    for (int cr = 0; cr < 20; ++cr) {
+        std::ifstream part(spill.paths[cr], std::ios::binary);
+        for (std::size_t left = nAny[cr]; left > 0;) {
+            const std::size_t m = std::min(left, rows.size());
+            if (!part.read(reinterpret_cast<char*>(rows.data()), m * sizeof(MonsterStats)))
+                throw std::runtime_error("Cannot read " + spill.paths[cr]);
+            const std::span<const MonsterStats> chunk(rows.data(), m);
+            spell.clear();
+            regular.clear();
+            for (MonsterStats const& row : chunk) (row.causeSave ? spell : regular).push_back(row);
+            writer.append(EncType::any, chunk);
+            writer.append(EncType::spellcaster, spell);
+            writer.append(EncType::regular, regular);
+            left -= m;
+        }
+    }
+    writer.finish();
+    // Round trip: the file has to be one the loader accepts
+    Catalog check(output);
+    return report;
+}
+}
@@ -0,0 +1,52 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef IMPORTER_H
+#define IMPORTER_H
+
+#include <string>
+#include "catalog.h"
+
+namespace dndSim{
+
+    // Imports monster stat blocks into a binary catalogue. A stat block has the
+    // arguments all_monsters.cpp passes to monster_stats, and the file is either CSV,
+    //     name,cr,str,dex,con,int,wis,cha,saves,atkStat,ac,causeSave
+    //     Homarid,1,12,13,12,12,10,10,dex wis,0,13,false
+    // with an optional header line first and the save proficiencies, each at most
+    // once, separated by spaces, or JSON Lines (optionally wrapped in a top-level
+    // array), one block per line:
+    //     {"name": "Homarid", "cr": 1, "stats": [12,13,12,12,10,10], "saves": [1,4],
+    //      "atkStat": 0, "ac": 13, "causeSave": false}
+    // Stats may be given by index or by name (str, dex, ...). The format is detected
+    // from the first character. The file is read in fixed-size blocks, each parsed
+    // by nThread threads, and the rows of each CR are spilled in file order to a
+    // temporary file next to the output, which is removed afterwards. The catalogue
+    // is then written from the spilled rows a chunk at a time, so memory is bounded
+    // by the blocks whatever the number of rows. Names are checked but not stored,
+    // since the catalogue has no names. Every CR needs both save-forcing and attacking
+    // monsters. The written file is loaded once as a check. Throws
+    // std::runtime_error on unreadable files, malformed stat blocks, empty pools and
+    // rejected output.
+    struct ImportReport {
+        std::size_t rows = 0;
+        std::size_t bytes = 0;
+    };
+    ImportReport import_catalog(std::string const& input, std::string const& output, unsigned int nThread);
+}
+
+#endif // IMPORTER_H
@@ -0,0 +1,121 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "outcomes.h"
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#ifdef DNDSIM_PSTL
+#include <execution>
+#endif
+#include <cmath>
+#include <new>
+#include <stdexcept>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace dndSim{
+
+OutcomeStore::OutcomeStore(std::size_t nCells, std::size_t n, Pages pages)
+    : nCells(nCells), n(n), cellWords((n + 63) / 64)
+{
+    // Huge pages need the words aligned to one, 2 MiB on x86-64
+    const std::size_t alignment = pages == Pages::huge ? std::size_t(1) << 21 : 4096;
+    const std::size_t bytes = (nCells * cellWords * sizeof(std::uint64_t) + alignment - 1) / alignment * alignment;
+    words.reset(static_cast<std::uint64_t*>(std::aligned_alloc(alignment, std::max(bytes, alignment))));
+    if (!words) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+    if (pages == Pages::huge) madvise(words.get(), bytes, MADV_HUGEPAGE);
+#endif
+}
+
+void OutcomeStore::clear(std::size_t firstCell, std::size_t lastCell)
+{
+    std::fill(words.get() + firstCell * cellWords, words.get() + lastCell * cellWords, std::uint64_t(0));
+}
+
+void OutcomeStore::store(std::size_t c, std::size_t first, std::span<const unsigned char> outcomes)
+{
+    if (first % 64 != 0 || first + outcomes.size() > n) throw std::out_of_range("Outcomes must start on a word of the cell.");
+    std::uint64_t* out = words.get() + c * cellWords + first / 64;
+    for (std::size_t i = 0; i < outcomes.size(); i += 64) {
+        const std::size_t m = std::min<std::size_t>(64, outcomes.size() - i);
+        std::uint64_t word = 0;
+        for (std::size_t j = 0; j < m; ++j) word |= std::uint64_t(outcomes[i + j] & 1) << j;
+        *out++ = word;
+    }
+}
+
+std::size_t OutcomeStore::count(std::span<const std::uint64_t> cell, std::size_t first, std::size_t last)
+{
+    if (first >= last) return 0;
+    const std::size_t firstWord = first / 64, lastWord = (last - 1) / 64;
+    const std::uint64_t firstMask = ~std::uint64_t(0) << (first % 64);
+    const std::uint64_t lastMask = ~std::uint64_t(0) >> (63 - (last - 1) % 64);
+    if (firstWord == lastWord) return std::popcount(cell[firstWord] & firstMask & lastMask);
+    std::size_t successes = std::popcount(cell[firstWord] & firstMask) + std::popcount(cell[lastWord] & lastMask);
+    auto popcount = [](std::uint64_t word) { return std::size_t(std::popcount(word)); };
+#ifdef DNDSIM_PSTL
+    return std::transform_reduce(std::execution::unseq, cell.begin() + firstWord + 1, cell.begin() + lastWord,
+                                 successes, std::plus<>(), popcount);
+#else
+    return std::transform_reduce(cell.begin() + firstWord + 1, cell.begin() + lastWord, successes, std::plus<>(), popcount);
+#endif
+}
+
+Interval wilson_interval(std::size_t successes, std::size_t trials, double z)
+{
+    if (trials == 0) return {0., 1.};
+    const double n = trials, p = successes / n, z2 = z * z;
+    const double centre = (p + z2 / (2. * n)) / (1. + z2 / n);
+    const double halfWidth = z / (1. + z2 / n) * std::sqrt(p * (1. - p) / n + z2 / (4. * n * n));
+    return {std::max(0., centre - halfWidth), std::min(1., centre + halfWidth)};
+}
+
+Interval bootstrap_interval(std::span<const std::uint64_t> cell, std::span<const std::size_t> offsets,
+                            std::span<const double> probability, unsigned int nResamples, double level,
+                            RNG::Philox4x32 rng)
+{
+    if (nResamples == 0 || !(level > 0. && level < 1.)) throw std::invalid_argument("A bootstrap needs resamples and a level in (0, 1).");
+    // Redrawing the n_i trials of a stratum with replacement gives Binomial(n_i, s_i / n_i)
+    // successes, so each resample draws one count per stratum instead of n_i outcomes
+    std::vector<RNG::Binomial> redraw;
+    std::vector<double> weight;
+    double covered = 0.;
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+        const std::size_t size = offsets[i + 1] - offsets[i];
+        if (size == 0) continue;
+        redraw.emplace_back(size, double(OutcomeStore::count(cell, offsets[i], offsets[i + 1])) / size);
+        weight.push_back(probability[i] / size);
+        covered += probability[i];
+    }
+    std::vector<double> estimates(nResamples);
+    for (auto& estimate : estimates) {
+        double sum = 0.;
+        for (std::size_t i = 0; i < redraw.size(); ++i) sum += weight[i] * redraw[i](rng);
+        estimate = sum / covered;
+    }
+    const double tail = (1. - level) / 2.;
+    auto quantile = [&](double q) {
+        const std::size_t k = std::min<std::size_t>(nResamples - 1, static_cast<std::size_t>(q * nResamples));
+        std::nth_element(estimates.begin(), estimates.begin() + k, estimates.end());
+        return estimates[k];
+    };
+    return {quantile(tail), quantile(1. - tail)};
+}
+}
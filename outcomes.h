@@ -0,0 +1,89 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef OUTCOMES_H
+#define OUTCOMES_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <vector>
+#include "rng.h"
+
+namespace dndSim{
+
+    // Every outcome of a sweep, one bit per battle: bit k % 64 of word k / 64 of its
+    // cell, each cell starting on a new word. Eight times smaller than a byte per
+    // battle, and counted 64 battles per popcount.
+    //
+    // The constructor allocates the words without touching them, and clear zeroes a
+    // range of cells. Clearing each cell on the thread that will store it places its
+    // pages on that thread's NUMA node, rather than all on the node of the thread that
+    // built the store. Huge pages ask the kernel to back the words with transparent
+    // huge pages, which saves TLB misses on large sweeps.
+    enum class Pages { standard, huge };
+
+    class OutcomeStore {
+    public:
+        OutcomeStore(std::size_t nCells, std::size_t n, Pages pages = Pages::standard);
+
+        // Zeroes cells [firstCell, lastCell); every cell has to be cleared before it is used
+        void clear(std::size_t firstCell, std::size_t lastCell);
+
+        std::size_t cells() const { return nCells; }
+        std::size_t trials() const { return n; }
+        std::span<const std::uint64_t> cell(std::size_t c) const { return {words.get() + c * cellWords, cellWords}; }
+
+        // Packs the outcomes of trials [first, first + outcomes.size()) of cell c; first
+        // has to be a multiple of 64. Different cells can be stored from different threads.
+        void store(std::size_t c, std::size_t first, std::span<const unsigned char> outcomes);
+
+        // The successes among trials [first, last) of a cell
+        static std::size_t count(std::span<const std::uint64_t> cell, std::size_t first, std::size_t last);
+        static bool outcome(std::span<const std::uint64_t> cell, std::size_t k) { return cell[k / 64] >> (k % 64) & 1; }
+
+    private:
+        struct Free {
+            void operator()(std::uint64_t* p) const { std::free(p); }
+        };
+        std::size_t nCells, n, cellWords;
+        std::unique_ptr<std::uint64_t[], Free> words;
+    };
+
+    // A confidence interval of a rate
+    struct Interval {
+        double lower, upper;
+        double halfWidth() const { return (upper - lower) / 2.; }
+    };
+
+    // Wilson score interval of a binomial rate, at z standard deviations (1.96 for 95%)
+    Interval wilson_interval(std::size_t successes, std::size_t trials, double z = 1.96);
+
+    // Percentile bootstrap confidence interval of the rate of one cell, computed on its
+    // packed outcomes. The trials are split into strata [offsets[i], offsets[i + 1])
+    // with encounter probabilities p_i (a single stratum {0, n}, {1} for random
+    // sampling); each resample redraws the trials of every stratum with replacement
+    // and is estimated like Strata::rate. The successes of each stratum are counted
+    // once and a resample draws its count from their binomial, so a resample costs
+    // one draw per stratum whatever the number of trials.
+    Interval bootstrap_interval(std::span<const std::uint64_t> cell, std::span<const std::size_t> offsets,
+                                std::span<const double> probability, unsigned int nResamples, double level,
+                                RNG::Philox4x32 rng);
+}
+
+#endif // OUTCOMES_H
@@ -16,64 +16,155 @@
 //==============================================================================
 
 #include "rng.h"
+#include <algorithm>
+
+// The batched kernels are built for AVX-512, AVX2 and baseline x86-64, and the
+// best one is picked at load time.
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#define RNG_SIMD_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RNG_SIMD_CLONES
+#endif
 
 namespace RNG
 {
 
-unsigned int genRNG(unsigned int size, RNG_t& rng)
-{
-    std::uniform_int_distribution<int> distribution(0, size - 1);
-    return distribution(rng);
-}
+namespace {
 
-unsigned short int roll1d20(RNG_t& rng)
+// Philox blocks pos, pos+1, ... of one stream, computed lanes blocks at a time
+// so that every round is a handful of vector multiplies and xors.
+RNG_SIMD_CLONES
+void philoxBlocks(Philox4x32::key_type key, std::uint64_t stream, std::uint64_t pos, std::uint32_t* out, std::size_t nBlocks)
 {
-    std::uniform_int_distribution<int> distribution(1, 20);
-    return distribution(rng);
+    constexpr std::size_t lanes = 16;
+    for (std::size_t b = 0; b < nBlocks; b += lanes) {
+        std::uint32_t c0[lanes], c1[lanes], c2[lanes], c3[lanes];
+        for (std::size_t l = 0; l < lanes; ++l) {
+            const std::uint64_t p = pos + b + l;
+            c0[l] = static_cast<std::uint32_t>(p);
+            c1[l] = static_cast<std::uint32_t>(p >> 32);
+            c2[l] = static_cast<std::uint32_t>(stream);
+            c3[l] = static_cast<std::uint32_t>(stream >> 32);
+        }
+        std::uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; ++round) {
+            for (std::size_t l = 0; l < lanes; ++l) {
+                const std::uint64_t p0 = std::uint64_t(0xD2511F53) * c0[l];
+                const std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * c2[l];
+                const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+                const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+                c0[l] = n0;
+                c1[l] = static_cast<std::uint32_t>(p1);
+                c2[l] = n2;
+                c3[l] = static_cast<std::uint32_t>(p0);
+            }
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        const std::size_t m = std::min(lanes, nBlocks - b);
+        for (std::size_t l = 0; l < m; ++l) {
+            out[4 * (b + l) + 0] = c0[l];
+            out[4 * (b + l) + 1] = c1[l];
+            out[4 * (b + l) + 2] = c2[l];
+            out[4 * (b + l) + 3] = c3[l];
+        }
+    }
 }
 
-unsigned short int barb_roll1d20(RNG_t& rng)
-{
-    std::uniform_int_distribution<int> distribution(1, 20);
-    return distribution(rng);
 }
 
-unsigned short int cler_roll1d20(RNG_t& rng)
+// Lanes of 64-bit words: multiplying by 20 = 16 + 4 is done with shifts, so the
+// high half (the face) is the two shifted-out top bits plus the carry of the sum.
+RNG_SIMD_CLONES
+std::size_t d20Faces(std::uint64_t const* words, std::size_t nWords, unsigned char* faces)
 {
-    std::uniform_int_distribution<int> distribution(1, 20);
-    return distribution(rng);
+    constexpr std::size_t lanes = 8;
+    constexpr unsigned int perWord = RNG_t::facesPerWord;
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < nWords; b += lanes) {
+        std::uint64_t w[lanes], accept[lanes];
+        unsigned char digits[perWord][lanes];
+        for (std::size_t l = 0; l < lanes; ++l) {
+            w[l] = words[b + l];
+            accept[l] = w[l] * RNG_t::facesRange >= RNG_t::facesReject;
+        }
+        for (unsigned int d = 0; d < perWord; ++d) {
+            std::uint64_t face[lanes];
+            for (std::size_t l = 0; l < lanes; ++l) {
+                const std::uint64_t x16 = w[l] << 4;
+                const std::uint64_t lo = x16 + (w[l] << 2);
+                face[l] = (w[l] >> 60) + (w[l] >> 62) + (lo < x16) + 1;
+                w[l] = lo;
+            }
+            for (std::size_t l = 0; l < lanes; ++l) digits[d][l] = static_cast<unsigned char>(face[l]);
+        }
+        const std::size_t m = std::min(lanes, nWords - b);
+        for (std::size_t l = 0; l < m; ++l) {
+            if (!accept[l]) continue;
+            for (unsigned int d = 0; d < perWord; ++d) faces[count + d] = digits[d][l];
+            count += perWord;
+        }
+    }
+    return count;
 }
 
-unsigned short int rog_roll1d20(RNG_t& rng)
+void Philox4x32::fill(std::span<result_type> out)
 {
-    std::uniform_int_distribution<int> distribution(1, 20);
-    return distribution(rng);
+    std::size_t i = 0;
+    while (idx < 4 && i < out.size()) out[i++] = buffer[idx++];
+    const std::size_t nBlocks = (out.size() - i) / 4;
+    philoxBlocks(key, stream, pos, out.data() + i, nBlocks);
+    pos += nBlocks;
+    i += 4 * nBlocks;
+    while (i < out.size()) out[i++] = (*this)();
 }
 
-unsigned short int wiz_roll1d20(RNG_t& rng)
+namespace {
+
+// A linear map on the 256-bit xoshiro state, stored as the images of the 256 unit vectors.
+using JumpMatrix = std::array<Xoshiro256pp::state_type, 256>;
+
+Xoshiro256pp::state_type apply(JumpMatrix const& matrix, Xoshiro256pp::state_type const& state)
 {
-    std::uniform_int_distribution<int> distribution(1, 20);
-    return distribution(rng);
+    // Masked rather than branching: the state bits are random, so a branch would mispredict half the time
+    Xoshiro256pp::state_type result = {};
+    for (unsigned int bit = 0; bit < 256; ++bit) {
+        const std::uint64_t mask = 0 - ((state[bit / 64] >> (bit % 64)) & 1);
+        for (unsigned int i = 0; i < 4; ++i) result[i] ^= matrix[bit][i] & mask;
+    }
+    return result;
 }
 
-unsigned short int roll2d20dl(RNG_t& rng)
+// jumpPowers()[i] jumps 2^i times. The first one is read off jump() applied to unit
+// vectors, every further one is the square of the previous.
+std::vector<JumpMatrix> const& jumpPowers()
 {
-    unsigned short int roll1 = roll1d20(rng);
-    unsigned short int roll2 = roll1d20(rng);
-    return std::max(roll1, roll2);
+    static const std::vector<JumpMatrix> powers = [] {
+        std::vector<JumpMatrix> result(64);
+        for (unsigned int bit = 0; bit < 256; ++bit) {
+            Xoshiro256pp::state_type unit = {};
+            unit[bit / 64] = std::uint64_t(1) << (bit % 64);
+            Xoshiro256pp engine;
+            engine.setState(unit);
+            engine.jump();
+            result[0][bit] = engine.getState();
+        }
+        for (unsigned int i = 1; i < result.size(); ++i) {
+            for (unsigned int bit = 0; bit < 256; ++bit) result[i][bit] = apply(result[i - 1], result[i - 1][bit]);
+        }
+        return result;
+    }();
+    return powers;
 }
 
-unsigned short int barb_roll2d20dl(RNG_t& rng)
-{
-    unsigned short int roll1 = barb_roll1d20(rng);
-    unsigned short int roll2 = barb_roll1d20(rng);
-    return std::max(roll1, roll2);
 }
 
-unsigned short int roll2d20dh(RNG_t& rng)
+Xoshiro256pp::state_type jumpXoshiro(Xoshiro256pp::state_type state, std::uint64_t times)
 {
-    unsigned short int roll1 = roll1d20(rng);
-    unsigned short int roll2 = roll1d20(rng);
-    return std::min(roll1, roll2);
+    auto const& powers = jumpPowers();
+    for (unsigned int i = 0; times != 0; ++i, times >>= 1) {
+        if (times & 1) state = apply(powers[i], state);
+    }
+    return state;
+}
 }
-}
\ No newline at end of file
@@ -20,19 +20,631 @@
 
 #include <vector>
 #include <random>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <algorithm>
+#include <utility>
+#include <concepts>
+#include <bit>
+#include <cmath>
 
 namespace RNG
 {
-using RNG_t = std::mt19937;
-unsigned int genRNG(unsigned int size, RNG_t& rng);
-unsigned short int roll1d20(RNG_t& rng);
-unsigned short int barb_roll1d20(RNG_t& rng);
-unsigned short int cler_roll1d20(RNG_t& rng);
-unsigned short int rog_roll1d20(RNG_t& rng);
-unsigned short int wiz_roll1d20(RNG_t& rng);
-unsigned short int roll2d20dl(RNG_t& rng);
-unsigned short int barb_roll2d20dl(RNG_t& rng);
-unsigned short int roll2d20dh(RNG_t& rng);
+// Anything the simulation can draw from: a uniform random bit generator with
+// full-range 32- or 64-bit output. The hot path is templated on it, so the
+// engine is picked at compile time and inlined into the trial loop.
+template<class G>
+concept Generator = std::uniform_random_bit_generator<G> && G::min() == 0 &&
+                    (G::max() == 0xFFFFFFFFu || G::max() == ~std::uint64_t(0));
+
+// 64 x 64 -> 128 bit product: returns the high half and stores the low half in lo.
+constexpr std::uint64_t mul128(std::uint64_t a, std::uint64_t b, std::uint64_t& lo)
+{
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 m = static_cast<unsigned __int128>(a) * b;
+    lo = static_cast<std::uint64_t>(m);
+    return static_cast<std::uint64_t>(m >> 64);
+#else
+    const std::uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32, bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    const std::uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+// SplitMix64: advances x and returns a well-mixed 64-bit word. Used for seeding.
+constexpr std::uint64_t splitmix64(std::uint64_t& x)
+{
+    std::uint64_t z = (x += 0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+// Counter-based Philox4x32-10 generator (Salmon et al., SC'11).
+// Every output is a pure function of (key, counter): the key holds the seed and
+// the upper half of the counter selects a stream, so any stream can be started
+// at any position without replaying earlier draws. The whole state is 44 bytes,
+// compared to the ~2.5 KB of std::mt19937.
+class Philox4x32
+{
+public:
+    using result_type = std::uint32_t;
+    using counter_type = std::array<std::uint32_t, 4>;
+    using key_type = std::array<std::uint32_t, 2>;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0)
+    {
+        this->seed(seed, stream);
+    }
+
+    void seed(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        key = {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+        this->stream = stream;
+        pos = 0;
+        idx = 4;
+    }
+
+    result_type operator()()
+    {
+        if (idx == 4) refill();
+        return buffer[idx++];
+    }
+
+    // Skips z outputs in constant time.
+    void discard(unsigned long long z)
+    {
+        const unsigned long long next = pos * 4 + idx - 4 + z;
+        pos = next / 4;
+        idx = 4;
+        if (next % 4) {
+            refill();
+            idx = next % 4;
+        }
+    }
+
+    // Writes the next out.size() outputs, exactly as out.size() calls to operator()
+    // would. Whole counter blocks are generated many lanes at a time.
+    void fill(std::span<result_type> out);
+
+    // The raw bijection: ten Philox rounds of ctr under key.
+    static constexpr counter_type block(counter_type ctr, key_type key)
+    {
+        for (int round = 0; round < 10; ++round) {
+            const std::uint64_t p0 = std::uint64_t(0xD2511F53) * ctr[0];
+            const std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * ctr[2];
+            ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+            key[0] += 0x9E3779B9;
+            key[1] += 0xBB67AE85;
+        }
+        return ctr;
+    }
+
+private:
+    key_type key;
+    std::uint64_t stream;
+    std::uint64_t pos;
+    counter_type buffer;
+    unsigned int idx;
+
+    void refill()
+    {
+        buffer = block({static_cast<std::uint32_t>(pos), static_cast<std::uint32_t>(pos >> 32),
+                        static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)}, key);
+        ++pos;
+        idx = 0;
+    }
+};
+
+// xoshiro256++ (Blackman & Vigna): 32 bytes of state, very fast 64-bit output.
+// The stream is hashed into the seed; StreamFactory gives non-overlapping streams.
+class Xoshiro256pp
+{
+public:
+    using result_type = std::uint64_t;
+    using state_type = std::array<std::uint64_t, 4>;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit Xoshiro256pp(std::uint64_t seed = 0, std::uint64_t stream = 0)
+    {
+        this->seed(seed, stream);
+    }
+
+    void seed(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        std::uint64_t x = seed, y = ~stream;
+        for (auto& word : s) word = splitmix64(x) ^ splitmix64(y);
+    }
+
+    result_type operator()()
+    {
+        const std::uint64_t result = std::rotl(s[0] + s[3], 23) + s[0];
+        const std::uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = std::rotl(s[3], 45);
+        return result;
+    }
+
+    // Advances the state by 2^128 outputs.
+    void jump()
+    {
+        constexpr std::uint64_t poly[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+        std::array<std::uint64_t, 4> t = {};
+        for (auto word : poly) {
+            for (int b = 0; b < 64; ++b) {
+                if (word & (std::uint64_t(1) << b)) {
+                    for (int i = 0; i < 4; ++i) t[i] ^= s[i];
+                }
+                (*this)();
+            }
+        }
+        s = t;
+    }
+
+    state_type const& getState() const { return s; }
+    void setState(state_type const& state) { s = state; }
+
+private:
+    state_type s;
+};
+
+// Advances a xoshiro256 state by times * 2^128 outputs, i.e. times calls to jump(),
+// in O(log times) using precomputed powers of the jump as GF(2) matrices.
+Xoshiro256pp::state_type jumpXoshiro(Xoshiro256pp::state_type state, std::uint64_t times);
+
+#ifdef __SIZEOF_INT128__
+// pcg64, i.e. PCG XSL RR 128/64 (O'Neill): a 128-bit LCG with a permuted output.
+// The stream selects the LCG increment. Needs a compiler with 128-bit integers.
+class Pcg64
+{
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit Pcg64(std::uint64_t seed = 0, std::uint64_t stream = 0)
+    {
+        this->seed(seed, stream);
+    }
+
+    void seed(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        state = 0;
+        inc = (static_cast<unsigned __int128>(stream) << 1) | 1;
+        step();
+        state += seed;
+        step();
+    }
+
+    result_type operator()()
+    {
+        step();
+        const std::uint64_t xored = static_cast<std::uint64_t>(state >> 64) ^ static_cast<std::uint64_t>(state);
+        return std::rotr(xored, static_cast<int>(state >> 122));
+    }
+
+    // Skips delta outputs in O(log delta) (Brown, "Random number generation with arbitrary strides").
+    void advance(unsigned __int128 delta)
+    {
+        unsigned __int128 accMult = 1, accPlus = 0, curMult = mult, curPlus = inc;
+        while (delta > 0) {
+            if (delta & 1) {
+                accMult *= curMult;
+                accPlus = accPlus * curMult + curPlus;
+            }
+            curPlus = (curMult + 1) * curPlus;
+            curMult *= curMult;
+            delta >>= 1;
+        }
+        state = accMult * state + accPlus;
+    }
+
+    void discard(unsigned long long z)
+    {
+        advance(z);
+    }
+
+private:
+    static constexpr unsigned __int128 mult = (static_cast<unsigned __int128>(0x2360ED051FC65DA4) << 64) | 0x4385DF649FCCF645;
+    unsigned __int128 state;
+    unsigned __int128 inc;
+
+    void step()
+    {
+        state = state * mult + inc;
+    }
+};
+#endif
+
+// std::mt19937_64 with the (seed, stream) constructor of the other engines.
+class Mt19937_64 : public std::mt19937_64
+{
+public:
+    explicit Mt19937_64(std::uint64_t seed = 0, std::uint64_t stream = 0)
+    {
+        this->seed(seed, stream);
+    }
+
+    using std::mt19937_64::seed;
+    void seed(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        std::seed_seq seq{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                          static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+        std::mt19937_64::seed(seq);
+    }
+};
+
+// Stream id of one block of trials in the hit-rate sweep. Drawing the generator
+// from StreamFactory(seed).stream(streamID) makes every trial block reproducible on its own,
+// independent of which thread runs it or in which order.
+constexpr std::uint64_t streamID(unsigned int npcLvl, unsigned int pcClass, unsigned int pcLvl, std::uint64_t block)
+{
+    return (std::uint64_t(npcLvl) << 56) | (std::uint64_t(pcClass) << 48) | (std::uint64_t(pcLvl) << 40) | block;
+}
+
+// Uniform integer in [0, size), by Lemire's multiply-shift with rejection.
+template<Generator G>
+unsigned int below(G& rng, unsigned int size)
+{
+    if constexpr (G::max() == 0xFFFFFFFFu) {
+        std::uint64_t m = std::uint64_t(rng()) * size;
+        if (static_cast<std::uint32_t>(m) < size) {
+            const std::uint32_t reject = (0u - size) % size;
+            while (static_cast<std::uint32_t>(m) < reject) m = std::uint64_t(rng()) * size;
+        }
+        return static_cast<unsigned int>(m >> 32);
+    } else {
+        std::uint64_t lo;
+        std::uint64_t hi = mul128(rng(), size, lo);
+        if (lo < size) {
+            const std::uint64_t reject = (0 - std::uint64_t(size)) % size;
+            while (lo < reject) hi = mul128(rng(), size, lo);
+        }
+        return static_cast<unsigned int>(hi);
+    }
+}
+
+// Uniform double in [0, 1), from the top 53 bits of one 64-bit draw or two 32-bit ones.
+template<Generator G>
+double uniform01(G& rng)
+{
+    std::uint64_t word = rng();
+    if constexpr (G::max() == 0xFFFFFFFFu) word = word << 32 | rng();
+    return (word >> 11) * 0x1p-53;
+}
+
+// Binomial(n, p) variates: the successes among n trials of probability p, without
+// drawing the trials. Small means are inverted from the probability mass function,
+// larger ones use Hoermann's transformed rejection with squeeze (BTRS), which takes
+// a couple of draws whatever n. The constants depend on (n, p) alone, so a
+// distribution that is sampled many times is built once. Defined here, like the
+// dice, so that a seed gives the same variates with every standard library.
+class Binomial
+{
+public:
+    Binomial(std::uint64_t n, double p) : n(n), flip(p > 0.5), p(flip ? 1. - p : p)
+    {
+        const double q = 1. - this->p;
+        if (n == 0 || !(this->p > 0.)) {
+            this->p = 0.;
+        } else if (n * this->p < 10.) {
+            s = this->p / q;
+            a = (n + 1) * s;
+            r0 = std::exp(n * std::log1p(-this->p));
+        } else {
+            const double spq = std::sqrt(n * this->p * q);
+            b = 1.15 + 2.53 * spq;
+            a = -0.0873 + 0.0248 * b + 0.01 * this->p;
+            c = n * this->p + 0.5;
+            alpha = (2.83 + 5.1 / b) * spq;
+            vr = 0.92 - 4.2 / b;
+            lpq = std::log(this->p / q);
+            m = std::floor((n + 1) * this->p);
+            h = std::lgamma(m + 1.) + std::lgamma(n - m + 1.);
+        }
+    }
+
+    template<Generator G>
+    std::uint64_t operator()(G& rng) const
+    {
+        const std::uint64_t k = draw(rng);
+        return flip ? n - k : k;
+    }
+
+private:
+    std::uint64_t n;
+    bool flip;          // p > 1/2 counts the failures of 1 - p instead
+    double p, s = 0., a = 0., r0 = 0., b = 0., c = 0., alpha = 0., vr = 0., lpq = 0., m = 0., h = 0.;
+
+    template<Generator G>
+    std::uint64_t draw(G& rng) const
+    {
+        if (p == 0.) return 0;
+        if (b == 0.) {
+            double r = r0, u = uniform01(rng);
+            std::uint64_t k = 0;
+            while (u > r && k < n) {
+                u -= r;
+                ++k;
+                r *= a / k - s;
+            }
+            return k;
+        }
+        for (;;) {
+            const double u = uniform01(rng) - 0.5, us = 0.5 - std::abs(u);
+            double v = uniform01(rng);
+            const double k = std::floor((2. * a / us + b) * u + c);
+            if (k < 0. || k > n) continue;
+            if (us >= 0.07 && v <= vr) return static_cast<std::uint64_t>(k);
+            v = std::log(v * alpha / (a / (us * us) + b));
+            if (v <= h - std::lgamma(k + 1.) - std::lgamma(n - k + 1.) + (k - m) * lpq) return static_cast<std::uint64_t>(k);
+        }
+    }
+};
+
+// Converts nWords 64-bit words into d20 faces (1..20), fourteen per accepted word,
+// and returns the number of faces written. Rejected words produce nothing.
+// words must be readable up to the next multiple of 8.
+std::size_t d20Faces(std::uint64_t const* words, std::size_t nWords, unsigned char* faces);
+
+// Dice on top of any Generator.
+// Results are defined by this file alone, not by std::uniform_int_distribution,
+// so a given seed rolls the same dice with every compiler and standard library.
+// d20 faces come fourteen at a time from one 64-bit word w: they are the base-20
+// digits of Lemire's multiply-shift w * 20^14 / 2^64, and w is rejected when the
+// low half of that product falls into the biased tail (2.3% of words).
+template<Generator Engine>
+class Dice : public Engine
+{
+    static constexpr bool is32 = Engine::max() == 0xFFFFFFFFu;
+
+public:
+    using Engine::Engine;
+    explicit Dice(Engine const& engine) : Engine(engine) {}
+
+    static constexpr unsigned int facesPerWord = 14;
+    static constexpr std::uint64_t facesRange = 1638400000000000000ull; // 20^14
+    static constexpr std::uint64_t facesReject = (0 - facesRange) % facesRange;
+
+    template<class... Args>
+    void seed(Args&&... args)
+    {
+        Engine::seed(std::forward<Args>(args)...);
+        facesLeft = 0;
+    }
+
+    // A 64-bit word; 32-bit engines contribute the high half first.
+    std::uint64_t next64()
+    {
+        if constexpr (is32) {
+            const std::uint64_t hi = (*this)();
+            const std::uint64_t lo = (*this)();
+            return (hi << 32) | lo;
+        } else {
+            return (*this)();
+        }
+    }
+
+    unsigned short int d20()
+    {
+        if (facesLeft == 0) {
+            do {
+                faceWord = next64();
+            } while (faceWord * facesRange < facesReject);
+            facesLeft = facesPerWord;
+        }
+        std::uint64_t lo;
+        const std::uint64_t face = mul128(faceWord, 20, lo);
+        faceWord = lo;
+        --facesLeft;
+        return static_cast<unsigned short int>(face + 1);
+    }
+
+    // Same faces as out.size() calls to d20(), converted a chunk of words at a time.
+    void fill1d20(std::span<unsigned char> out)
+    {
+        constexpr std::size_t chunk = 64;
+        std::size_t i = 0;
+        while (facesLeft > 0 && i < out.size()) out[i++] = static_cast<unsigned char>(d20());
+        std::uint64_t words[chunk] = {};
+        while (out.size() - i >= facesPerWord) {
+            const std::size_t nWords = std::min(chunk, (out.size() - i) / facesPerWord);
+            if constexpr (is32 && requires(Engine& e, std::span<std::uint32_t> s) { e.fill(s); }) {
+                std::uint32_t halves[2 * chunk];
+                this->fill({halves, 2 * nWords});
+                for (std::size_t w = 0; w < nWords; ++w) words[w] = (std::uint64_t(halves[2 * w]) << 32) | halves[2 * w + 1];
+            } else {
+                for (std::size_t w = 0; w < nWords; ++w) words[w] = next64();
+            }
+            i += d20Faces(words, nWords, out.data() + i);
+        }
+        while (i < out.size()) out[i++] = static_cast<unsigned char>(d20());
+    }
+
+private:
+    std::uint64_t faceWord = 0;
+    unsigned int facesLeft = 0;
+};
+
+using RNG_t = Dice<Philox4x32>;
+
+// Hands out streams of one engine, all derived from a single seed. stream(id) is
+// cheap and can be called from any thread, in any order, for any number of ids.
+// Philox4x32 and the engines specialised below give provably non-overlapping
+// sequences for different ids: Philox takes the id as the upper half of its counter,
+// so seeding it from (seed, id) gives each stream a disjoint range of 2^66 outputs.
+// Any other engine seeded from (seed, id) only gets statistically independent streams.
+template<Generator Engine>
+class StreamFactory
+{
+public:
+    explicit StreamFactory(std::uint64_t seed) : seed(seed) {}
+    Engine stream(std::uint64_t id) const { return Engine(seed, id); }
+
+private:
+    std::uint64_t seed;
+};
+
+// Stream id is the id-th jump of 2^128 outputs along one sequence.
+template<>
+class StreamFactory<Xoshiro256pp>
+{
+public:
+    explicit StreamFactory(std::uint64_t seed) : base(seed) {}
+    Xoshiro256pp stream(std::uint64_t id) const
+    {
+        Xoshiro256pp engine;
+        engine.setState(jumpXoshiro(base.getState(), id));
+        return engine;
+    }
+
+private:
+    Xoshiro256pp base;
+};
+
+#ifdef __SIZEOF_INT128__
+// Stream id starts id * 2^64 steps along one LCG of period 2^128.
+template<>
+class StreamFactory<Pcg64>
+{
+public:
+    explicit StreamFactory(std::uint64_t seed) : base(seed) {}
+    Pcg64 stream(std::uint64_t id) const
+    {
+        Pcg64 engine = base;
+        engine.advance(static_cast<unsigned __int128>(id) << 64);
+        return engine;
+    }
+
+private:
+    Pcg64 base;
+};
+#endif
+
+template<Generator Engine>
+class StreamFactory<Dice<Engine>>
+{
+public:
+    explicit StreamFactory(std::uint64_t seed) : engines(seed) {}
+    Dice<Engine> stream(std::uint64_t id) const { return Dice<Engine>(engines.stream(id)); }
+
+private:
+    StreamFactory<Engine> engines;
+};
+
+template<Generator G>
+unsigned int genRNG(unsigned int size, G& rng)
+{
+    return below(rng, size);
+}
+
+template<Generator G>
+unsigned short int roll1d20(G& rng)
+{
+    if constexpr (requires { rng.d20(); })
+        return rng.d20();
+    else
+        return static_cast<unsigned short int>(below(rng, 20) + 1);
+}
+
+template<Generator G>
+unsigned short int barb_roll1d20(G& rng)
+{
+    return roll1d20(rng);
+}
+
+template<Generator G>
+unsigned short int cler_roll1d20(G& rng)
+{
+    return roll1d20(rng);
+}
+
+template<Generator G>
+unsigned short int rog_roll1d20(G& rng)
+{
+    return roll1d20(rng);
+}
+
+template<Generator G>
+unsigned short int wiz_roll1d20(G& rng)
+{
+    return roll1d20(rng);
+}
+
+template<Generator G>
+unsigned short int roll2d20dl(G& rng)
+{
+    unsigned short int roll1 = roll1d20(rng);
+    unsigned short int roll2 = roll1d20(rng);
+    return std::max(roll1, roll2);
+}
+
+template<Generator G>
+unsigned short int barb_roll2d20dl(G& rng)
+{
+    unsigned short int roll1 = barb_roll1d20(rng);
+    unsigned short int roll2 = barb_roll1d20(rng);
+    return std::max(roll1, roll2);
+}
+
+template<Generator G>
+unsigned short int roll2d20dh(G& rng)
+{
+    unsigned short int roll1 = roll1d20(rng);
+    unsigned short int roll2 = roll1d20(rng);
+    return std::min(roll1, roll2);
+}
+
+// Batched dice: fill out with independent rolls in one call, without a
+// distribution object or a function call per roll.
+template<Generator G>
+void fill1d20(std::span<unsigned char> out, G& rng)
+{
+    if constexpr (requires { rng.fill1d20(out); }) {
+        rng.fill1d20(out);
+    } else {
+        for (auto& face : out) face = static_cast<unsigned char>(roll1d20(rng));
+    }
+}
+
+template<Generator G>
+void fill2d20dl(std::span<unsigned char> out, G& rng)
+{
+    constexpr std::size_t chunk = 512;
+    unsigned char faces[2 * chunk];
+    for (std::size_t i = 0; i < out.size(); i += chunk) {
+        const std::size_t m = std::min(chunk, out.size() - i);
+        fill1d20({faces, 2 * m}, rng);
+        for (std::size_t j = 0; j < m; ++j) out[i + j] = std::max(faces[2 * j], faces[2 * j + 1]);
+    }
+}
+
+template<Generator G>
+void fill2d20dh(std::span<unsigned char> out, G& rng)
+{
+    constexpr std::size_t chunk = 512;
+    unsigned char faces[2 * chunk];
+    for (std::size_t i = 0; i < out.size(); i += chunk) {
+        const std::size_t m = std::min(chunk, out.size() - i);
+        fill1d20({faces, 2 * m}, rng);
+        for (std::size_t j = 0; j < m; ++j) out[i + j] = std::min(faces[2 * j], faces[2 * j + 1]);
+    }
+}
 }
 
-#endif
\ No newline at end of file
+#endif
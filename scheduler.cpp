@@ -0,0 +1,302 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "scheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace dndSim{
+
+namespace {
+
+using Range = std::pair<std::size_t, std::size_t>;
+
+thread_local unsigned int currentWorker = 0;
+
+// The statistics of a worker, on cache lines of their own since every worker updates its
+// own after each range
+struct alignas(cacheLine) WorkerSlot {
+    WorkerStats stats;
+};
+
+// A worker's pending ranges. The deque only ever holds a few ranges, so a lock is
+// cheap next to a task. Thieves read the size first, so that they do not lock
+// queues with nothing to steal. Each queue has cache lines of its own.
+struct alignas(cacheLine) WorkQueue {
+    std::mutex mutex;
+    std::deque<Range> ranges;
+    std::atomic_size_t size {0};
+
+    void push(Range range)
+    {
+        std::lock_guard lock(mutex);
+        ranges.push_back(range);
+        size.store(ranges.size(), std::memory_order_relaxed);
+    }
+    bool popBack(Range& range)
+    {
+        if (size.load(std::memory_order_relaxed) == 0) return false;
+        std::lock_guard lock(mutex);
+        if (ranges.empty()) return false;
+        range = ranges.back();
+        ranges.pop_back();
+        size.store(ranges.size(), std::memory_order_relaxed);
+        return true;
+    }
+    bool popFront(Range& range)
+    {
+        if (size.load(std::memory_order_relaxed) == 0) return false;
+        std::lock_guard lock(mutex);
+        if (ranges.empty()) return false;
+        range = ranges.front();
+        ranges.pop_front();
+        size.store(ranges.size(), std::memory_order_relaxed);
+        return true;
+    }
+};
+
+#ifdef __linux__
+// CPUs of a list such as 0-3,8-11, as in /sys/devices/system/node/node*/cpulist
+std::vector<int> parseCPUList(std::string const& list)
+{
+    std::vector<int> result;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) continue;
+        const auto dash = range.find('-');
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+    return result;
+}
+
+// The CPUs this process may run on, grouped by NUMA node; one group if the nodes are unknown
+std::vector<std::vector<int>> allowedCPUsByNode()
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return {};
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0;; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file) break;
+        std::string list;
+        std::getline(file, list);
+        std::vector<int> cpus;
+        for (int cpu : parseCPUList(list))
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+        if (!cpus.empty()) nodes.push_back(std::move(cpus));
+    }
+    if (nodes.empty()) {
+        nodes.emplace_back();
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &allowed)) nodes.back().push_back(cpu);
+    }
+    return nodes;
+}
+#endif
+
+}
+
+struct TaskScheduler::Pool {
+    std::vector<std::thread> threads;
+    std::unique_ptr<WorkQueue[]> queues;
+    std::unique_ptr<WorkerSlot[]> slots;
+
+    // The current run
+    std::function<void(std::size_t)> const* task = nullptr;
+    std::size_t grain = 1;
+    // Ranges that are queued or held by a worker that may still split them. A range
+    // is counted before it is queued, so this never drops to 0 while work can appear.
+    alignas(cacheLine) std::atomic_size_t open {0};
+
+    // Workers wait on wake for the next run, and the last to leave a run signals finished
+    std::mutex mutex;
+    std::condition_variable wake, finished;
+    std::size_t generation = 0;
+    unsigned int active = 0;
+    bool stop = false;
+};
+
+TaskScheduler::TaskScheduler(unsigned int nThread, Affinity affinity)
+    : nThread(std::max(nThread, 1u)), pool(std::make_unique<Pool>())
+{
+#ifdef __linux__
+    std::vector<int> order;
+    if (affinity != Affinity::none) {
+        const auto nodes = allowedCPUsByNode();
+        if (affinity == Affinity::compact) {
+            for (auto const& node : nodes) order.insert(order.end(), node.begin(), node.end());
+        } else {
+            // One CPU of each node in turn
+            for (std::size_t i = 0; order.size() < this->nThread; ++i) {
+                bool any = false;
+                for (auto const& node : nodes) {
+                    if (i < node.size()) order.push_back(node[i]);
+                    any |= i < node.size();
+                }
+                if (!any) break;
+            }
+        }
+    }
+    for (unsigned int w = 0; w < this->nThread && !order.empty(); ++w) cpus.push_back(order[w % order.size()]);
+#endif
+
+    pool->queues = std::make_unique<WorkQueue[]>(this->nThread);
+    pool->slots = std::make_unique<WorkerSlot[]>(this->nThread);
+    for (unsigned int w = 0; w < this->nThread; ++w) {
+        pool->threads.emplace_back([this, w] {
+            // Pinned before its first task, so that the pages a worker touches first are on its node
+#ifdef __linux__
+            if (!cpus.empty()) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpus[w], &set);
+                pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            }
+#endif
+            currentWorker = w;
+            std::size_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock lock(pool->mutex);
+                    pool->wake.wait(lock, [&] { return pool->stop || pool->generation != seen; });
+                    if (pool->stop) return;
+                    seen = pool->generation;
+                }
+                work(w);
+                std::lock_guard lock(pool->mutex);
+                if (--pool->active == 0) pool->finished.notify_one();
+            }
+        });
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard lock(pool->mutex);
+        pool->stop = true;
+    }
+    pool->wake.notify_all();
+    for (auto& thread : pool->threads) thread.join();
+}
+
+void TaskScheduler::work(unsigned int self)
+{
+    WorkerStats& stats = pool->slots[self].stats;
+    WorkQueue* queues = pool->queues.get();
+    Range range;
+    unsigned int idle = 0;
+    while (pool->open.load(std::memory_order_acquire) > 0) {
+        bool found = queues[self].popBack(range);
+        for (unsigned int i = 1; !found && i < nThread; ++i) {
+            found = queues[(self + i) % nThread].popFront(range);
+            stats.steals += found;
+        }
+        if (!found) {
+            // Only ranges being split are left: wait for them, yielding at first and then
+            // sleeping for up to 128 us, rather than hammering the other workers' locks
+            if (++idle <= 4) std::this_thread::yield();
+            else std::this_thread::sleep_for(std::chrono::microseconds(1u << std::min(idle - 4, 7u)));
+            continue;
+        }
+        idle = 0;
+        while (range.second - range.first > pool->grain) {
+            const std::size_t mid = range.first + (range.second - range.first) / 2;
+            pool->open.fetch_add(1, std::memory_order_relaxed);
+            queues[self].push({mid, range.second});
+            range.second = mid;
+        }
+        pool->open.fetch_sub(1, std::memory_order_release);
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = range.first; i < range.second; ++i) (*pool->task)(i);
+        stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stats.tasks += range.second - range.first;
+    }
+}
+
+void TaskScheduler::run(std::size_t nTasks, std::size_t grain, std::function<void(std::size_t)> const& task)
+{
+    // The workers are all waiting, so the queues and slots can be set up without locks
+    std::size_t open = 0;
+    for (unsigned int w = 0; w < nThread; ++w) {
+        const std::size_t begin = nTasks * w / nThread, end = nTasks * (w + 1) / nThread;
+        auto& queue = pool->queues[w];
+        queue.ranges.clear();
+        if (begin < end) queue.ranges.push_back({begin, end});
+        queue.size.store(queue.ranges.size(), std::memory_order_relaxed);
+        open += queue.ranges.size();
+        pool->slots[w].stats = {};
+    }
+    {
+        std::lock_guard lock(pool->mutex);
+        pool->task = &task;
+        pool->grain = std::max<std::size_t>(grain, 1);
+        pool->open.store(open, std::memory_order_relaxed);
+        pool->active = nThread;
+        ++pool->generation;
+    }
+    pool->wake.notify_all();
+    {
+        std::unique_lock lock(pool->mutex);
+        pool->finished.wait(lock, [&] { return pool->active == 0; });
+    }
+    workerStats.clear();
+    for (unsigned int w = 0; w < nThread; ++w) workerStats.push_back(pool->slots[w].stats);
+}
+
+unsigned int TaskScheduler::worker()
+{
+    return currentWorker;
+}
+
+void TaskScheduler::report(std::ostream& out) const
+{
+    if (workerStats.empty()) return;
+    std::size_t tasks = 0, steals = 0, minTasks = workerStats[0].tasks, maxTasks = 0;
+    double busy = 0., maxBusy = 0.;
+    for (auto const& stats : workerStats) {
+        tasks += stats.tasks;
+        steals += stats.steals;
+        minTasks = std::min(minTasks, stats.tasks);
+        maxTasks = std::max(maxTasks, stats.tasks);
+        busy += stats.busySeconds;
+        maxBusy = std::max(maxBusy, stats.busySeconds);
+    }
+    const double meanBusy = busy / workerStats.size();
+    out << "Load balance: " << workerStats.size() << " workers, " << tasks << " tasks (" << minTasks << " to " << maxTasks
+        << " per worker), " << steals << " steals, busy " << meanBusy * 1e3 << " ms on average and " << maxBusy * 1e3
+        << " ms at most (imbalance " << (meanBusy > 0. ? maxBusy / meanBusy : 1.) << ")" << std::endl;
+}
+}
@@ -0,0 +1,112 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace dndSim{
+
+    // Alignment that keeps data written by different threads on different cache lines.
+    // Two 64-byte lines, since x86 cores prefetch lines in adjacent pairs; fixed rather
+    // than std::hardware_destructive_interference_size, which may differ between
+    // compilers and so should not shape types in headers.
+    inline constexpr std::size_t cacheLine = 128;
+
+    // Allocator whose arrays start on a cache line and are padded to a whole number of
+    // them, so that arrays written by different threads never share a line
+    template<class T>
+    struct CacheLineAllocator {
+        using value_type = T;
+
+        CacheLineAllocator() = default;
+        template<class U>
+        CacheLineAllocator(CacheLineAllocator<U> const&) {}
+
+        T* allocate(std::size_t n)
+        {
+            const std::size_t bytes = (n * sizeof(T) + cacheLine - 1) / cacheLine * cacheLine;
+            return static_cast<T*>(::operator new(bytes, std::align_val_t(cacheLine)));
+        }
+        void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(cacheLine)); }
+
+        template<class U>
+        bool operator==(CacheLineAllocator<U> const&) const { return true; }
+    };
+
+    // What one worker did in a TaskScheduler run
+    struct WorkerStats {
+        std::size_t tasks = 0;
+        std::size_t steals = 0;
+        double busySeconds = 0.;
+    };
+
+    // Work-stealing scheduler over a range of task indices. Each worker owns a deque of
+    // index ranges and starts with an equal share. It takes ranges from the back of its
+    // own deque and, once that is empty, steals from the front of another worker's, where
+    // the largest pending range sits. A range longer than the grain is split in two
+    // before it runs, and the back half goes on the deque for thieves, so the work only
+    // spreads out when some workers run dry. A worker leaves a run once no range is
+    // queued or being split, and backs off while it waits for one that is.
+    //
+    // The worker threads are started once, by the constructor, and wait for the next
+    // run in between, so repeated runs do not pay for creating threads.
+    //
+    // Workers can be pinned to CPUs: compact fills the allowed CPUs in order, scatter
+    // deals the workers out over the NUMA nodes in turn, so that a sweep uses the memory
+    // bandwidth of every socket. Pinning is a no-op outside Linux.
+    enum class Affinity { none, compact, scatter };
+
+    class TaskScheduler {
+    public:
+        explicit TaskScheduler(unsigned int nThread, Affinity affinity = Affinity::none);
+        ~TaskScheduler();
+        TaskScheduler(TaskScheduler const&) = delete;
+        TaskScheduler& operator=(TaskScheduler const&) = delete;
+
+        // Runs task(i) for every i in [0, nTasks) on nThread threads, at most grain
+        // consecutive tasks per range, and returns once all have run. Runs cannot
+        // overlap, and a task must not start a run of the same scheduler.
+        void run(std::size_t nTasks, std::size_t grain, std::function<void(std::size_t)> const& task);
+
+        // Index of the worker running the calling task, in [0, nThread), for results
+        // kept per worker; 0 outside run
+        static unsigned int worker();
+        unsigned int threads() const { return nThread; }
+
+        // The statistics of the last run, and a summary of how evenly it was spread
+        std::vector<WorkerStats> const& stats() const { return workerStats; }
+        void report(std::ostream& out) const;
+
+    private:
+        struct Pool;
+        void work(unsigned int self);
+
+        unsigned int nThread;
+        std::vector<int> cpus;  // CPU of each worker, none if empty
+        std::vector<WorkerStats> workerStats;
+        std::unique_ptr<Pool> pool;
+    };
+}
+
+#endif // SCHEDULER_H
@@ -0,0 +1,391 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A testing suite for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "sweep.h"
+#include "thresholds.h"
+#include <numeric>
+#include <functional>
+#include <iostream>
+#include <cmath>
+#include <atomic>
+#include <memory>
+#include <optional>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef DNDSIM_PSTL
+#include <execution>
+#endif
+
+// Returns the value of a "--name=value" argument, or fallback if it was not given
+std::string getOption(int argc, char* argv[], std::string const& name, std::string const& fallback){
+    const std::string prefix = "--" + name + "=";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.compare(0, prefix.size(), prefix) == 0) return arg.substr(prefix.size());
+    }
+    return fallback;
+}
+
+// Returns whether the "--name" flag was given
+bool hasFlag(int argc, char* argv[], std::string const& name){
+    for (int i = 1; i < argc; ++i) {
+        if (argv[i] == "--" + name) return true;
+    }
+    return false;
+}
+
+// Averages the exact probabilities over the monsters of each CR instead of sampling them,
+// by weight if weights are given
+void exactRates(RateMatrices const& PC_hit_rate, RateMatrices const& NPC_hit_rate, dndSim::EncounterWeights const* weights){
+    for (auto lvlPC : test_levels){
+        for(auto lvlNPC : test_levels){
+            for (unsigned int l = 0; l < 4; ++l){
+                dndSim::with_premade(dndSim::PCClass(l), lvlPC, [&](auto const& pc) {
+                    PC_hit_rate[l][lvlNPC-1][lvlPC-1] = weights ? dndSim::exact_hit_rate(pc, *weights, lvlNPC) : dndSim::exact_hit_rate(pc, lvlNPC);
+                    NPC_hit_rate[l][lvlNPC-1][lvlPC-1] = weights ? dndSim::exact_def_rate(pc, *weights, lvlNPC) : dndSim::exact_def_rate(pc, lvlNPC);
+                });
+            }
+        }
+    }
+}
+
+SweepReport simulateRates(SweepOptions const& options, RateMatrices const& PC_hit_rate, RateMatrices const& NPC_hit_rate){
+    const std::size_t n = options.n;
+
+    // The outcomes of a block of battles only live until they are counted, so the sweep
+    // needs memory for its cells, not its battles. A task runs a range of blocks of one
+    // cell, keeps its counts locally and adds them to the cell's once it is done.
+    // Stratified cells count the successes of each monster.
+    // With a target epsilon, a cell is a single task and stops after the first block that meets it.
+    using Tally = std::vector<std::size_t, dndSim::CacheLineAllocator<std::size_t>>;
+    struct CellCounts {
+        std::size_t trials = 0, hits = 0, defs = 0;   // totals of the cell, summed over its monsters at the end
+        Tally monsterHits, monsterDefs;
+    };
+    using CellBlock = std::vector<CellCounts, dndSim::CacheLineAllocator<CellCounts>>;
+    const std::size_t nCells = 4 * test_levels.size() * test_levels.size();
+    std::vector<CellCounts> counts(nCells);
+    // Unless every outcome is kept, packed a bit per battle, and counted afterwards
+    std::unique_ptr<dndSim::OutcomeStore> hitStore, defStore;
+    if (options.keepOutcomes) {
+        const auto pages = options.hugePages ? dndSim::Pages::huge : dndSim::Pages::standard;
+        hitStore = std::make_unique<dndSim::OutcomeStore>(nCells, n, pages);
+        defStore = std::make_unique<dndSim::OutcomeStore>(nCells, n, pages);
+    }
+
+    // Run the simulation for each character class and level
+    // The actual loop order is pretty irrelevant, so long as we get all the combinations
+    // Just don't mess up the indices
+    // Each block of trialBlock battles draws from its own stream, handed out by the
+    // stream factory for (NPC level, class, PC level, block). Streams never overlap,
+    // so the tasks are uncorrelated however many there are, any battle can be
+    // regenerated without replaying the ones before it, and the result does not
+    // depend on which thread ran which block.
+    // The whole sweep is instantiated for the selected engine, so the attack/save chain
+    // and the dice inline into the trial loop.
+    // The table kernel looks every check up instead of resolving it; the tables are
+    // built once and shared read-only by all threads.
+    const std::size_t trialBlock = 4096;
+    const bool useTable = options.kernel == "table";
+    const auto table = useTable ? std::make_unique<dndSim::ThresholdTable>() : nullptr;
+    // Stratified sampling fixes the monster of every battle of a cell up front
+    std::vector<dndSim::Strata> strata;
+    if (options.sampling != "random") {
+        const auto allocation = options.sampling == "neyman" ? dndSim::Allocation::neyman : dndSim::Allocation::proportional;
+        for (unsigned int l = 0; l < 4; ++l){
+            for (auto lvlNPC : test_levels){
+                for (auto lvlPC : test_levels){
+                    dndSim::AliasTable const* weights = options.weights ? &options.weights->table(lvlNPC, dndSim::EncType::any) : nullptr;
+                    strata.push_back(dndSim::allocate_trials(*table, dndSim::PCClass(l), lvlPC, lvlNPC, n, allocation, weights));
+                }
+            }
+        }
+    }
+    for (std::size_t c = 0; c < strata.size(); ++c) {
+        counts[c].monsterHits.resize(strata[c].probability.size());
+        counts[c].monsterDefs.resize(strata[c].probability.size());
+    }
+    // Atomic for the cells shared by the OpenMP threads, plain for counts of a single worker or thread
+    auto addCounts = [](CellCounts& total, CellCounts const& part, bool shared = true) {
+        auto add = [shared](std::size_t& sum, std::size_t value) {
+            if (shared) std::atomic_ref(sum).fetch_add(value, std::memory_order_relaxed);
+            else sum += value;
+        };
+        if (!shared) {
+            total.monsterHits.resize(std::max(total.monsterHits.size(), part.monsterHits.size()));
+            total.monsterDefs.resize(std::max(total.monsterDefs.size(), part.monsterDefs.size()));
+        }
+        add(total.trials, part.trials);
+        add(total.hits, part.hits);
+        add(total.defs, part.defs);
+        for (std::size_t i = 0; i < part.monsterHits.size(); ++i) add(total.monsterHits[i], part.monsterHits[i]);
+        for (std::size_t i = 0; i < part.monsterDefs.size(); ++i) add(total.monsterDefs[i], part.monsterDefs[i]);
+    };
+    // The OpenMP backend runs every phase on its own threads, so the scheduler's workers
+    // are only started for the threads backend, and not at all if one is given
+    std::optional<dndSim::TaskScheduler> ownScheduler;
+    auto scheduler = [&]() -> dndSim::TaskScheduler& {
+        if (options.scheduler) return *options.scheduler;
+        if (!ownScheduler) ownScheduler.emplace(options.nThread, options.affinity);
+        return *ownScheduler;
+    };
+#ifdef _OPENMP
+    const bool useOpenMP = options.backend == "openmp";
+#endif
+    auto forEachCell = [&](auto&& task) {
+#ifdef _OPENMP
+        if (useOpenMP) {
+            #pragma omp parallel for schedule(static) num_threads(options.nThread)
+            for (std::size_t c = 0; c < nCells; ++c) task(c);
+            return;
+        }
+#endif
+        scheduler().run(nCells, 1, task);
+    };
+    // Each worker clears the cells it starts the sweep with, which puts their pages on its NUMA node
+    if (hitStore) {
+        forEachCell([&](std::size_t c) {
+            hitStore->clear(c, c + 1);
+            defStore->clear(c, c + 1);
+        });
+    }
+    auto runSweep = [&](auto engineType) {
+        using Generator = typename decltype(engineType)::type;
+        const RNG::StreamFactory<Generator> streams(options.seed);
+
+        auto testCell = [&](auto lvlNPC, unsigned int l, auto lvlPC, auto const& pc, std::size_t firstBlock, std::size_t lastBlock) {
+            CellCounts cell;
+            dndSim::Strata const* cellStrata = strata.empty() ? nullptr : &strata[cellIndex(l, lvlNPC, lvlPC)];
+            if (cellStrata) {
+                cell.monsterHits.resize(cellStrata->probability.size());
+                cell.monsterDefs.resize(cellStrata->probability.size());
+            }
+            unsigned char hitBlock[trialBlock], defBlock[trialBlock];
+            dndSim::AliasTable const* weights = options.weights ? &options.weights->table(lvlNPC, dndSim::EncType::any) : nullptr;
+            auto drawMonster = [&](Generator& rng) {
+                return weights ? dndSim::random_monster(*options.weights, lvlNPC, dndSim::EncType::any, rng)
+                               : dndSim::random_monster(lvlNPC, dndSim::EncType::any, rng);
+            };
+            auto runBlock = [&](std::size_t kBegin, std::span<unsigned char> hits, std::span<unsigned char> defs, Generator& localRNG) {
+                if (useTable) {
+                    if (cellStrata)
+                        dndSim::simulate_strata(*table, dndSim::PCClass(l), lvlPC, lvlNPC, *cellStrata, kBegin, hits, defs, localRNG);
+                    else
+                        dndSim::simulate_cell(*table, dndSim::PCClass(l), lvlPC, lvlNPC, hits, defs, localRNG, weights);
+                    return;
+                }
+                if (options.kernel == "variant") {
+                    const dndSim::combatant self = dndSim::premade(dndSim::PCClass(l), lvlPC);
+                    for (std::size_t k = 0; k < hits.size(); ++k) {
+                        const dndSim::combatant npc = drawMonster(localRNG);
+                        hits[k] = dndSim::attack(self, npc, localRNG);
+                        defs[k] = dndSim::attack(npc, self, localRNG);
+                    }
+                    return;
+                }
+                if constexpr (std::is_same_v<Generator, RNG::RNG_t>) {
+                    if (options.kernel == "virtual") {
+                        dndSim::character const& self = pc;
+                        for (std::size_t k = 0; k < hits.size(); ++k) {
+                            auto const& npc = weights ? dndSim::encounters(lvlNPC, dndSim::EncType::any)[weights->sample(localRNG)]
+                                                      : dndSim::random_encounter(lvlNPC, dndSim::EncType::any, localRNG);
+                            hits[k] = self.attack(npc, localRNG);
+                            defs[k] = npc.attack(self, localRNG);
+                        }
+                        return;
+                    }
+                }
+                for (std::size_t k = 0; k < hits.size(); ++k) {
+                    const auto npc = drawMonster(localRNG);
+                    hits[k] = dndSim::attack(pc, npc, localRNG);
+                    defs[k] = dndSim::attack(npc, pc, localRNG);
+                }
+            };
+            // Adaptive cells check their intervals every checkStep battles. The steps split a
+            // block without changing its draws, so where a cell stops does not depend on it.
+            const std::size_t checkStep = options.epsilon > 0. ? 512 : trialBlock;
+            bool done = false;
+            for (std::size_t block = firstBlock; block < lastBlock && !done; ++block) {
+                Generator localRNG = streams.stream(RNG::streamID(lvlNPC, l, lvlPC, block));
+                const std::size_t blockEnd = std::min(n, (block + 1) * trialBlock);
+                for (std::size_t kBegin = block * trialBlock; kBegin < blockEnd && !done; kBegin += checkStep) {
+                    const std::size_t m = std::min(blockEnd - kBegin, checkStep);
+                    cell.trials += m;
+                    if (useTable && !hitStore) {
+                        // Outcomes that are not kept are counted as the battles are resolved
+                        if (cellStrata) {
+                            dndSim::count_strata(*table, dndSim::PCClass(l), lvlPC, lvlNPC, *cellStrata, kBegin, m,
+                                                 cell.monsterHits, cell.monsterDefs, localRNG);
+                        } else {
+                            const auto battles = dndSim::count_cell(*table, dndSim::PCClass(l), lvlPC, lvlNPC, m, localRNG, weights);
+                            cell.hits += battles.hits;
+                            cell.defs += battles.defs;
+                        }
+                    } else {
+                        const std::span<unsigned char> hits(hitBlock, m);
+                        const std::span<unsigned char> defs(defBlock, m);
+                        runBlock(kBegin, hits, defs, localRNG);
+                        if (hitStore) {
+                            hitStore->store(cellIndex(l, lvlNPC, lvlPC), kBegin, hits);
+                            defStore->store(cellIndex(l, lvlNPC, lvlPC), kBegin, defs);
+                        } else {
+                            cell.hits += std::accumulate(hits.begin(), hits.end(), std::size_t(0));
+                            cell.defs += std::accumulate(defs.begin(), defs.end(), std::size_t(0));
+                        }
+                    }
+                    done = options.epsilon > 0.
+                        && dndSim::wilson_interval(cell.hits, cell.trials).halfWidth() < options.epsilon
+                        && dndSim::wilson_interval(cell.defs, cell.trials).halfWidth() < options.epsilon;
+                }
+            }
+            return cell;
+        };
+
+        // The tasks of a cell, for each character class, enemy level and character level,
+        // are consecutive, so that a worker's range stays within few cells
+        const std::size_t nBlocks = (n + trialBlock - 1) / trialBlock;
+        const std::size_t grain = options.epsilon > 0. ? nBlocks : options.grain;
+        const std::size_t tasksPerCell = (nBlocks + grain - 1) / grain;
+        auto testChunk = [&](unsigned int l, auto lvlNPC, auto lvlPC, std::size_t chunk) {
+            const std::size_t firstBlock = chunk * grain;
+            CellCounts cell;
+            dndSim::with_premade(dndSim::PCClass(l), lvlPC, [&](auto const& pc) {
+                cell = testCell(lvlNPC, l, lvlPC, pc, firstBlock, std::min(nBlocks, firstBlock + grain));
+            });
+            return cell;
+        };
+
+#ifdef _OPENMP
+        // Each thread counts into its own cells, which are summed once its share of the loop is done
+        if (useOpenMP) {
+            const omp_sched_t kind = options.schedule == "dynamic" ? omp_sched_dynamic
+                                   : options.schedule == "guided" ? omp_sched_guided : omp_sched_static;
+            omp_set_schedule(kind, 0);
+            const std::size_t nLevels = test_levels.size();
+            #pragma omp parallel num_threads(options.nThread)
+            {
+                CellBlock local(nCells);
+                #pragma omp for collapse(4) schedule(runtime)
+                for (unsigned int l = 0; l < 4; ++l)
+                    for (std::size_t npc = 0; npc < nLevels; ++npc)
+                        for (std::size_t pc = 0; pc < nLevels; ++pc)
+                            for (std::size_t chunk = 0; chunk < tasksPerCell; ++chunk)
+                                addCounts(local[cellIndex(l, test_levels[npc], test_levels[pc])],
+                                          testChunk(l, test_levels[npc], test_levels[pc], chunk), false);
+                for (std::size_t c = 0; c < nCells; ++c)
+                    if (local[c].trials > 0) addCounts(counts[c], local[c]);
+            }
+            return;
+        }
+#endif
+        // The scheduler's workers count into blocks of their own, which are summed once the
+        // sweep is done, since neighbouring cells are often run by different workers. The
+        // blocks and their per-monster tallies start on cache lines of their own, and each
+        // worker allocates and clears its block at its first task, so its pages are on the
+        // worker's NUMA node. The headers are only written then, and are padded as well.
+        struct alignas(dndSim::cacheLine) WorkerCounts {
+            CellBlock cells;
+        };
+        std::vector<WorkerCounts> workerCounts(scheduler().threads());
+        auto testTask = [&](std::size_t task) {
+            const std::size_t cell = task / tasksPerCell;
+            const unsigned int l = cell / (test_levels.size() * test_levels.size());
+            const auto lvlNPC = test_levels[cell / test_levels.size() % test_levels.size()];
+            const auto lvlPC = test_levels[cell % test_levels.size()];
+            CellBlock& block = workerCounts[dndSim::TaskScheduler::worker()].cells;
+            if (block.empty()) block.resize(nCells);
+            addCounts(block[cell], testChunk(l, lvlNPC, lvlPC, task % tasksPerCell), false);
+        };
+
+        scheduler().run(nCells * tasksPerCell, 1, testTask);
+        for (auto const& worker : workerCounts)
+            for (std::size_t c = 0; c < worker.cells.size(); ++c)
+                if (worker.cells[c].trials > 0) addCounts(counts[c], worker.cells[c], false);
+        if (options.balanceReport) scheduler().report(std::cout);
+    };
+    withEngine(options.engine, runSweep);
+
+    // Kept outcomes are counted a word at a time. Random sampling makes a cell one
+    // stratum of probability one.
+    const std::array<std::size_t, 2> whole = {0, n};
+    const std::array<double, 1> one = {1.};
+    auto cellOffsets = [&](std::size_t c) {
+        return strata.empty() ? std::span<const std::size_t>(whole) : std::span<const std::size_t>(strata[c].offsets);
+    };
+    auto cellProbability = [&](std::size_t c) {
+        return strata.empty() ? std::span<const double>(one) : std::span<const double>(strata[c].probability);
+    };
+    auto countOutcomes = [&](std::size_t c) {
+        const auto offsets = cellOffsets(c);
+        auto countStrata = [&](dndSim::OutcomeStore const& store, Tally& successes) {
+            successes.resize(offsets.size() - 1);
+            for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+                successes[i] = dndSim::OutcomeStore::count(store.cell(c), offsets[i], offsets[i + 1]);
+        };
+        countStrata(*hitStore, counts[c].monsterHits);
+        countStrata(*defStore, counts[c].monsterDefs);
+    };
+
+    // Each rate is resampled from its own stream, which the sweep never uses since
+    // its NPC levels start at 1
+    SweepReport report;
+    if (options.bootstrap > 0) {
+        report.hit.resize(nCells);
+        report.def.resize(nCells);
+        const RNG::StreamFactory<RNG::Philox4x32> streams(options.seed);
+        forEachCell([&](std::size_t c) {
+            report.hit[c] = dndSim::bootstrap_interval(hitStore->cell(c), cellOffsets(c), cellProbability(c),
+                                                       options.bootstrap, 0.95, streams.stream(RNG::streamID(0, 0, 0, 2 * c)));
+            report.def[c] = dndSim::bootstrap_interval(defStore->cell(c), cellOffsets(c), cellProbability(c),
+                                                       options.bootstrap, 0.95, streams.stream(RNG::streamID(0, 0, 0, 2 * c + 1)));
+        });
+    }
+
+    // Calculate the hit rates, counting the kept outcomes first
+    // Stratified cells weight the mean of each monster by its encounter probability
+    auto reduceCell = [&](std::size_t c) {
+        if (hitStore) countOutcomes(c);
+        // Counts kept per monster or stratum give the totals of the cell
+        if (hitStore || !strata.empty()) {
+            counts[c].hits = std::accumulate(counts[c].monsterHits.begin(), counts[c].monsterHits.end(), std::size_t(0));
+            counts[c].defs = std::accumulate(counts[c].monsterDefs.begin(), counts[c].monsterDefs.end(), std::size_t(0));
+        }
+        const unsigned int l = c / (test_levels.size() * test_levels.size());
+        const auto lvlNPC = test_levels[c / test_levels.size() % test_levels.size()];
+        const auto lvlPC = test_levels[c % test_levels.size()];
+        auto const& cell = counts[c];
+        if (strata.empty()) {
+            PC_hit_rate[l][lvlNPC-1][lvlPC-1] = cell.hits / static_cast<float>(cell.trials);
+            NPC_hit_rate[l][lvlNPC-1][lvlPC-1] = cell.defs / static_cast<float>(cell.trials);
+        } else {
+            PC_hit_rate[l][lvlNPC-1][lvlPC-1] = strata[c].rate(cell.monsterHits);
+            NPC_hit_rate[l][lvlNPC-1][lvlPC-1] = strata[c].rate(cell.monsterDefs);
+        }
+    };
+    // The cells are reduced by the parallel algorithms of the standard library if the build
+    // has a backend for them (make pstl), and by the sweep's threads otherwise
+#ifdef DNDSIM_PSTL
+    std::vector<std::size_t> cells(nCells);
+    std::iota(cells.begin(), cells.end(), std::size_t(0));
+    std::for_each(std::execution::par, cells.begin(), cells.end(), reduceCell);
+#else
+    forEachCell(reduceCell);
+#endif
+    for (auto const& cell : counts) report.trials.push_back(cell.trials);
+    return report;
+}
@@ -0,0 +1,96 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A testing suite for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "dndSim.h"
+#include "weights.h"
+#include "outcomes.h"
+#include "scheduler.h"
+
+// The sweep over every character class, enemy level and character level, shared by the
+// test suite and the benchmarks, and the command-line helpers of both
+
+// Returns the value of a "--name=value" argument, or fallback if it was not given
+std::string getOption(int argc, char* argv[], std::string const& name, std::string const& fallback = "");
+
+// Returns whether the "--name" flag was given
+bool hasFlag(int argc, char* argv[], std::string const& name);
+
+// Calls f with a std::type_identity of the generator named by engine, returns false if there is none
+template<typename F>
+bool withEngine(std::string const& engine, F&& f){
+    if (engine == "philox") f(std::type_identity<RNG::Dice<RNG::Philox4x32>>{});
+    else if (engine == "xoshiro") f(std::type_identity<RNG::Dice<RNG::Xoshiro256pp>>{});
+#ifdef __SIZEOF_INT128__
+    else if (engine == "pcg64") f(std::type_identity<RNG::Dice<RNG::Pcg64>>{});
+#endif
+    else if (engine == "mt64") f(std::type_identity<RNG::Dice<RNG::Mt19937_64>>{});
+    else return false;
+    return true;
+}
+
+inline const std::vector<unsigned short int> test_levels = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+
+// Hit rate matrices of the four classes, indexed [class][NPC level - 1][PC level - 1]
+using RateMatrices = std::vector<float(*)[20]>;
+
+// Index of the cell of a class, enemy level and character level in per-cell arrays
+inline std::size_t cellIndex(unsigned int l, unsigned short int lvlNPC, unsigned short int lvlPC){
+    return (l * test_levels.size() + lvlNPC - 1) * test_levels.size() + lvlPC - 1;
+}
+
+// What a sweep reports besides the rates, indexed by cellIndex: the battles each cell
+// took, and the bootstrap intervals of its hit and defence rates if asked for
+struct SweepReport {
+    std::vector<std::size_t> trials;
+    std::vector<dndSim::Interval> hit, def;
+};
+
+struct SweepOptions {
+    std::size_t n;
+    unsigned int nThread;
+    std::uint64_t seed = 0;
+    std::string engine = "philox";
+    std::string kernel = "table";
+    dndSim::EncounterWeights const* weights = nullptr; // uniform encounters if null
+    std::string sampling = "random";
+    bool keepOutcomes = false;
+    unsigned int bootstrap = 0; // resamples per interval, no intervals if 0
+    double epsilon = 0.;        // target half-width of the 95% Wilson intervals, n battles per cell if 0
+    std::size_t grain = 1;      // trial blocks per task
+    bool balanceReport = false;
+    std::string backend = "threads";  // or openmp
+    std::string schedule = "static";  // loop schedule of the openmp backend
+    dndSim::Affinity affinity = dndSim::Affinity::none;
+    bool hugePages = false;     // back the kept outcomes with transparent huge pages
+    dndSim::TaskScheduler* scheduler = nullptr; // runs the sweep if given; else one of nThread workers is started
+};
+
+// Averages the exact probabilities over the monsters of each CR instead of sampling them,
+// by weight if weights are given
+void exactRates(RateMatrices const& PC_hit_rate, RateMatrices const& NPC_hit_rate, dndSim::EncounterWeights const* weights);
+
+// Simulates n battles (or, with a target epsilon, up to n) for every cell and fills in
+// the rates; see SweepOptions
+SweepReport simulateRates(SweepOptions const& options, RateMatrices const& PC_hit_rate, RateMatrices const& NPC_hit_rate);
+
+#endif // SWEEP_H
@@ -15,11 +15,14 @@
 // Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
 //==============================================================================
 
-#include "dndSim.h"
+#include "sweep.h"
+#include "importer.h"
 #include <numeric>
 #include <chrono>
-#include <functional>
+#include <type_traits>
 #include <fstream>
+#include <iostream>
+#include <cmath>
 
 #include <atomic>
 #include <thread>
@@ -27,28 +30,37 @@
 void usage(){
     std::cout << "Welcome to the TAD&DSIM test suite!" << std::endl;
     std::cout << "This program tests the balance of our random encounters." << std::endl;
-    std::cout << "Usage: ./testSuite [int n], where n is the number of battles you want to test per character level." << std::endl;
-    std::cout << "Any arguments besides n will be ignored at runtime." << std::endl;
+    std::cout << "Usage: ./testSuite [int n] [int nThread] [options], where n is the number of battles you want to test per character level." << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --seed=S      seed of the simulation; runs with the same seed produce identical results regardless of nThread" << std::endl;
+    std::cout << "  --engine=E    random number engine: philox (default), xoshiro, pcg64 or mt64" << std::endl;
+    std::cout << "  --kernel=K    trial kernel: table (default) compares each roll with a precomputed threshold, static resolves the checks per battle," << std::endl;
+    std::cout << "                variant dispatches them at runtime through std::visit, virtual through the character classes (philox only)" << std::endl;
+    std::cout << "  --sampling=S  how the monster of each battle is chosen: random (default) draws it, proportional or neyman" << std::endl;
+    std::cout << "                share the battles of a cell out among its monsters (stratified; table kernel only)" << std::endl;
+    std::cout << "  --keep-outcomes  keep every battle outcome, one bit each, and count the rates from them" << std::endl;
+    std::cout << "  --bootstrap=B 95% bootstrap intervals of every rate from B resamples of the kept outcomes (implies --keep-outcomes)" << std::endl;
+    std::cout << "  --epsilon=E   stop each cell once the 95% Wilson intervals of its rates are narrower than +-E, after at most n battles" << std::endl;
+    std::cout << "                (random sampling without kept outcomes only)" << std::endl;
+    std::cout << "  --grain=G     blocks of 4096 battles per task of the work-stealing scheduler (default 1; whole cells with --epsilon)" << std::endl;
+    std::cout << "  --balance     report how evenly the sweep was spread over the threads" << std::endl;
+    std::cout << "  --backend=B   run the sweep on the work-stealing scheduler (threads, default) or as a collapsed OpenMP loop (openmp;" << std::endl;
+    std::cout << "                needs the parallel build) over classes, levels and chunks of G blocks" << std::endl;
+    std::cout << "  --schedule=S  loop schedule of the openmp backend: static (default), dynamic or guided" << std::endl;
+    std::cout << "  --affinity=A  pin the scheduler's threads: none (default), compact in CPU order, or scatter over the NUMA nodes" << std::endl;
+    std::cout << "                (for the openmp backend, use OMP_PROC_BIND and OMP_PLACES)" << std::endl;
+    std::cout << "  --huge-pages  back the kept outcomes with transparent huge pages" << std::endl;
+    std::cout << "  --bench-sharing=T  time T threads adding to counters packed side by side and padded to cache lines, and exit" << std::endl;
+    std::cout << "  --catalog=F   draw the encounters from the binary monster catalogue F instead of the built-in one" << std::endl;
+    std::cout << "  --export-catalog=F  write the built-in monster catalogue to F and exit" << std::endl;
+    std::cout << "  --import-catalog=S  with --export-catalog=F, write the stat blocks of the CSV or JSON Lines file S to F instead" << std::endl;
+    std::cout << "  --spell-weight=W  draw save-forcing monsters W times as often as attacking ones of the same CR, W > 0 (default 1: uniform)" << std::endl;
+    std::cout << "  --exact       compute the hit rates exactly instead of simulating them (n is ignored)" << std::endl;
+    std::cout << "  --validate    compare the simulated hit rates to the exact ones" << std::endl;
+    std::cout << "Any other arguments will be ignored at runtime." << std::endl;
     std::cout << "Have fun!" << std::endl;
 }
 
-template<typename T>
-struct mdspan {
-  T* data;
-  std::array<std::size_t, 3> dims;
-
-  T& operator()(std::size_t lvl, std::size_t lvl2, std::size_t n) {
-    const std::size_t index = n + lvl2 * dims[2] + lvl * dims[2] * dims[1];
-    return data[index];
-  }
-};
-
-std::shared_ptr<std::vector<unsigned char>> initializeHitVector(unsigned int n, int dim1, int dim2)
-{
-    auto hitVector = std::make_shared<std::vector<unsigned char>>(n * dim1 * dim2, false);
-    return hitVector;
-}
-
 void plotAsciiHeatmap(float data[20][20]) {
     for (int i = 19; i > 0; --i) {
         std::cout << i+1 << " ";
@@ -69,161 +81,211 @@ void plotAsciiHeatmap(float data[20][20]) {
     std::cout << std::endl;
 }
 
+// Prints the largest deviation of the simulated rates from the exact ones, in units of the binomial standard error
+// of the battles each cell took, and how many bootstrap intervals, if any, contain the exact rate
+void validateRates(RateMatrices const& PC_hit_rate, RateMatrices const& NPC_hit_rate, dndSim::EncounterWeights const* weights,
+                   SweepReport const& report){
+    float exact_hit[4][20][20];
+    float exact_def[4][20][20];
+    exactRates({exact_hit[0], exact_hit[1], exact_hit[2], exact_hit[3]}, {exact_def[0], exact_def[1], exact_def[2], exact_def[3]}, weights);
+    double maxDeviation = 0., maxSigma = 0.;
+    for (int l = 0; l < 4; ++l){
+        for (int i = 0; i < 20; ++i){
+            for (int j = 0; j < 20; ++j){
+                for (auto [simulated, exact] : {std::pair{PC_hit_rate[l][i][j], exact_hit[l][i][j]}, std::pair{NPC_hit_rate[l][i][j], exact_def[l][i][j]}}){
+                    const double deviation = std::abs(simulated - exact);
+                    const double sigma = std::sqrt(exact * (1. - exact) / report.trials[cellIndex(l, i + 1, j + 1)]);
+                    maxDeviation = std::max(maxDeviation, deviation);
+                    maxSigma = std::max(maxSigma, sigma > 0. ? deviation / sigma : (deviation > 0. ? INFINITY : 0.));
+                }
+            }
+        }
+    }
+    std::cout << "Largest deviation from the exact rates: " << maxDeviation << " (" << maxSigma << " sigma)" << std::endl;
+    if (report.hit.empty()) return;
+    std::size_t covered = 0;
+    for (unsigned int l = 0; l < 4; ++l){
+        for (auto lvlNPC : test_levels){
+            for (auto lvlPC : test_levels){
+                const std::size_t c = cellIndex(l, lvlNPC, lvlPC);
+                for (auto [interval, exact] : {std::pair{report.hit[c], exact_hit[l][lvlNPC-1][lvlPC-1]}, std::pair{report.def[c], exact_def[l][lvlNPC-1][lvlPC-1]}}){
+                    // Exact rates are floats, so allow for their rounding
+                    covered += exact >= interval.lower - 1e-6 && exact <= interval.upper + 1e-6;
+                }
+            }
+        }
+    }
+    std::cout << "Bootstrap intervals containing the exact rate: " << covered << " of " << 2 * report.hit.size() << std::endl;
+}
+
+// Microbenchmark of false sharing: every thread adds to a counter of its own, either
+// packed next to those of the other threads or alone on its cache line, as the sweep's
+// per-worker counts are. Returns the wall time per add of each thread, in ns, of both.
+std::pair<double, double> benchmarkSharing(unsigned int nThread){
+    constexpr std::size_t adds = std::size_t(1) << 24;
+    struct Packed {
+        std::size_t value = 0;
+    };
+    struct alignas(dndSim::cacheLine) Padded {
+        std::size_t value = 0;
+    };
+    auto time = [&](auto tag) {
+        std::vector<typename decltype(tag)::type> counters(nThread);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < nThread; ++t) {
+            threads.emplace_back([&counters, t] {
+                // Every add goes through memory, as it would across the tasks of a sweep
+                std::atomic_ref value(counters[t].value);
+                for (std::size_t i = 0; i < adds; ++i) value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        const std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+        return ns.count() / adds;
+    };
+    return {time(std::type_identity<Packed>{}), time(std::type_identity<Padded>{})};
+}
+
 int main(int argc, char* argv[]){
-    if (argc < 2){
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]).compare(0, 2, "--") != 0) args.push_back(argv[i]);
+    }
+    const std::string exportPath = getOption(argc, argv, "export-catalog", "");
+    const std::string importPath = getOption(argc, argv, "import-catalog", "");
+    if (!exportPath.empty() && !importPath.empty()){
+        auto t1 = std::chrono::steady_clock::now();
+        try {
+            const auto report = dndSim::import_catalog(importPath, exportPath, std::thread::hardware_concurrency());
+            const std::chrono::duration<double, std::milli> ms = std::chrono::steady_clock::now() - t1;
+            std::cout << "Imported " << report.rows << " monsters (" << report.bytes << " bytes) from " << importPath
+                      << " to " << exportPath << " in " << ms.count() << " ms" << std::endl;
+        } catch (std::runtime_error const& error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    const unsigned int sharingThreads = std::stoul(getOption(argc, argv, "bench-sharing", "0"));
+    if (sharingThreads > 0){
+        const auto [packed, padded] = benchmarkSharing(sharingThreads);
+        std::cout << "Counters of " << sharingThreads << " threads: " << packed << " ns per add packed, "
+                  << padded << " ns per add padded to " << dndSim::cacheLine << " bytes" << std::endl;
+        return 0;
+    }
+    if (!exportPath.empty()){
+        dndSim::write_catalog(exportPath, dndSim::active_catalog);
+        std::cout << "Wrote the monster catalogue to " << exportPath << std::endl;
+        return 0;
+    }
+    const bool exact = hasFlag(argc, argv, "exact");
+    if (args.size() < 1 && !exact){
         usage();
         return 1;
     }
-    std::string nArg = argv[1];
-    std::size_t n = std::stoul(argv[1]);
-    if (n < 1){
+    SweepOptions options;
+    options.n = args.size() >= 1 ? std::stoul(args[0]) : 1;
+    if (options.n < 1){
         usage();
         return 1;
     }
-    unsigned int nThread = 12;
-    if (argc >= 3) {
-        nThread = std::stoi(argv[2]);
+    options.nThread = 12;
+    if (args.size() >= 2) {
+        options.nThread = std::stoi(args[1]);
     }
+    options.seed = std::stoull(getOption(argc, argv, "seed", "0"));
+    options.engine = getOption(argc, argv, "engine", "philox");
+    options.kernel = getOption(argc, argv, "kernel", "table");
+    options.sampling = getOption(argc, argv, "sampling", "random");
+    options.bootstrap = std::stoul(getOption(argc, argv, "bootstrap", "0"));
+    options.keepOutcomes = hasFlag(argc, argv, "keep-outcomes") || options.bootstrap > 0;
+    options.epsilon = std::stod(getOption(argc, argv, "epsilon", "0"));
+    options.grain = std::stoul(getOption(argc, argv, "grain", "1"));
+    options.balanceReport = hasFlag(argc, argv, "balance");
+    options.backend = getOption(argc, argv, "backend", "threads");
+    options.schedule = getOption(argc, argv, "schedule", "static");
+    const std::string affinity = getOption(argc, argv, "affinity", "none");
+    options.affinity = affinity == "compact" ? dndSim::Affinity::compact
+                     : affinity == "scatter" ? dndSim::Affinity::scatter : dndSim::Affinity::none;
+    options.hugePages = hasFlag(argc, argv, "huge-pages");
 
     using std::chrono::high_resolution_clock;
     using std::chrono::duration_cast;
     using std::chrono::duration;
     using std::chrono::milliseconds;
 
-    const std::vector<unsigned short int> test_levels = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
-
-    std::cout << "Testing dndSim..." << std::endl;
-
-    auto t1 = high_resolution_clock::now();
-
-    // Initialize the hit vectors for each character type
-    auto barbarian_hits = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto cleric_hits = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto rogue_hits = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto wizard_hits = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto barbarian_def = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto cleric_def = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto rogue_def = initializeHitVector(n, test_levels.size(), test_levels.size());
-    auto wizard_def = initializeHitVector(n, test_levels.size(), test_levels.size());
-    // Create a vector of the hit vectors for each character class
-    std::vector<mdspan<unsigned char>> hits(4);
-    hits[0] = mdspan<unsigned char>{barbarian_hits->data(), {test_levels.size(), test_levels.size(), n}};
-    hits[1] = mdspan<unsigned char>{cleric_hits->data(), {test_levels.size(), test_levels.size(), n}};
-    hits[2] = mdspan<unsigned char>{rogue_hits->data(),  {test_levels.size(), test_levels.size(), n}};
-    hits[3] = mdspan<unsigned char>{wizard_hits->data(), {test_levels.size(), test_levels.size(), n}};
-    std::vector<mdspan<unsigned char>> def(4);
-    def[0] = mdspan<unsigned char>{barbarian_def->data(),  {test_levels.size(), test_levels.size(), n}};
-    def[1] = mdspan<unsigned char>{cleric_def->data(),  {test_levels.size(), test_levels.size(), n}};
-    def[2] = mdspan<unsigned char>{rogue_def->data(),  {test_levels.size(), test_levels.size(), n}};
-    def[3] = mdspan<unsigned char>{wizard_def->data(),  {test_levels.size(), test_levels.size(), n}};
-
-    // Run the simulation for each character class and level
-    // The actual loop order is pretty irrelevant, so long as we get all the combinations
-    // Just don't mess up the indices
-    // The outer loop is for the number of battles to simulate
-    // Couldn't this be done in parallel?
-    // --- Not with this loop order, maybe if we moved the n-loop in?
-    // I don't think our random number generator is vectorized, so we'd have to do it manually
-    // ...Have you tried it?
-    // ...No
-    // The next loop is for the enemy levels
-    auto testNPCLevel = [&](auto lvlNPC) {
-        RNG::RNG_t localRNG;
-        // The next loop is for the character classes
-        // Maybe we could multithread here?
-        // Well, multithreading here would only use up to four threads
-        // Would it? The inner loop could be split across multiple threads
-        // Do we need to do that manually?
-        // Nah, I'm pretty sure OMP can handle that
-        // But wait, if it's just unfolding the loop, couldn't we just multithread the entire loop?
+    const std::vector<std::string> kernels = {"table", "static", "variant", "virtual"};
+    if (!withEngine(options.engine, [](auto){})
+        || std::find(kernels.begin(), kernels.end(), options.kernel) == kernels.end()
+        || (options.kernel == "virtual" && options.engine != "philox")
+        || (options.sampling != "random" && options.sampling != "proportional" && options.sampling != "neyman")
+        || (options.sampling != "random" && options.kernel != "table")
+        || options.grain < 1
+        || (options.backend != "threads" && options.backend != "openmp")
+        || (options.schedule != "static" && options.schedule != "dynamic" && options.schedule != "guided")
+        || (affinity != "none" && affinity != "compact" && affinity != "scatter")
+        || (options.epsilon < 0. || (options.epsilon > 0. && (options.sampling != "random" || options.keepOutcomes)))){
+        usage();
+        return 1;
+    }
+#ifndef _OPENMP
+    if (options.backend == "openmp"){
+        std::cerr << "The openmp backend needs a build with OpenMP: make clean parallel" << std::endl;
+        return 1;
+    }
+#endif
 
-        for (auto lvlPC : test_levels) {
-          auto & hitVector = hits[0];
-          auto & defVector = def[0];
-          for (std::size_t k = 0; k < n; ++k) {
-            auto const& npc = dndSim::random_encounter(lvlNPC, dndSim::EncType::any, localRNG);
-            hitVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::barbarian_premade[lvlPC].attack(npc, localRNG);
-            defVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::attack_barbarian(lvlPC, npc, localRNG);
-          }
-        }
-        for (auto lvlPC : test_levels) {
-          auto & hitVector = hits[1];
-          auto & defVector = def[1];
-          for (std::size_t k = 0; k < n; ++k) {
-            auto const& npc = dndSim::random_encounter(lvlNPC, dndSim::EncType::any, localRNG);
-            hitVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::cleric_premade[lvlPC].attack(npc, localRNG);
-            defVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::attack_cleric(lvlPC, npc, localRNG);
-          }
-        }
-        for (auto lvlPC : test_levels) {
-          auto & hitVector = hits[2];
-          auto & defVector = def[2];
-          for (std::size_t k = 0; k < n; ++k) {
-            auto const& npc = dndSim::random_encounter(lvlNPC, dndSim::EncType::any, localRNG);
-            hitVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::rogue_premade[lvlPC].attack(npc, localRNG);
-            defVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::attack_rogue(lvlPC, npc, localRNG);
-          }
+    std::unique_ptr<dndSim::Catalog> catalog;
+    const std::string catalogPath = getOption(argc, argv, "catalog", "");
+    if (!catalogPath.empty()){
+        try {
+            catalog = std::make_unique<dndSim::Catalog>(catalogPath);
+        } catch (std::runtime_error const& error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
         }
-        for (auto lvlPC : test_levels) {
-          auto & hitVector = hits[3];
-          auto & defVector = def[3];
-          for (std::size_t k = 0; k < n; ++k) {
-            auto const& npc = dndSim::random_encounter(lvlNPC, dndSim::EncType::any, localRNG);
-            hitVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::wizard_premade[lvlPC].attack(npc, localRNG);
-            defVector(lvlNPC - 1, lvlPC - 1, k) = dndSim::attack_wizard(lvlPC, npc, localRNG);
-          }
-        }
-    };
+        dndSim::use_catalog(*catalog);
+    }
 
-    std::atomic_uint32_t taskCounter { 0 };
-    auto runTasks = [&]() {
-        unsigned int currentTask = 0;
-        while ((currentTask = taskCounter.fetch_add(1)) < test_levels.size()) {
-            const auto NPCLevel = test_levels[currentTask];
-            testNPCLevel(NPCLevel);
+    // Weighted encounters follow the indices of the catalogue, so they are built after it is loaded
+    std::unique_ptr<dndSim::EncounterWeights> weights;
+    const double spellWeight = std::stod(getOption(argc, argv, "spell-weight", "1"));
+    if (spellWeight != 1.){
+        try {
+            weights = std::make_unique<dndSim::EncounterWeights>([spellWeight](dndSim::MonsterStats const& m) {
+                return m.causeSave ? spellWeight : 1.;
+            });
+        } catch (std::invalid_argument const& error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
         }
-    };
-
-    std::vector<std::thread> threads;
-    for (unsigned int i = 0; i < nThread; ++i) {
-        threads.emplace_back(runTasks);
     }
-    for (auto& thread : threads)
-        thread.join();
+    options.weights = weights.get();
+
+    std::cout << "Testing dndSim..." << std::endl;
+
+    auto t1 = high_resolution_clock::now();
 
     // Initialise the actual hit rate matrices
     float barbarian_hit_rate[20][20];
     float cleric_hit_rate[20][20];
     float rogue_hit_rate[20][20];
     float wizard_hit_rate[20][20];
-    std::vector<float(*)[20]> PC_hit_rate = {barbarian_hit_rate, cleric_hit_rate, rogue_hit_rate, wizard_hit_rate};
+    RateMatrices PC_hit_rate = {barbarian_hit_rate, cleric_hit_rate, rogue_hit_rate, wizard_hit_rate};
 
     // Initialize the hit rate matrices against each character
     float barbarian_def_rate[20][20];
     float cleric_def_rate[20][20];
     float rogue_def_rate[20][20];
     float wizard_def_rate[20][20];
-    std::vector<float(*)[20]> NPC_hit_rate = {barbarian_def_rate, cleric_def_rate, rogue_def_rate, wizard_def_rate};
+    RateMatrices NPC_hit_rate = {barbarian_def_rate, cleric_def_rate, rogue_def_rate, wizard_def_rate};
 
-
-    // Calculate the hit rates
-    // Here, the loop order is PC lvl > NPC lvl > PC class
-    for (auto lvlPC : test_levels){
-        for(auto lvlNPC : test_levels){
-            for (int l = 0; l < 4; ++l){
-              PC_hit_rate[l][lvlNPC-1][lvlPC-1] = std::accumulate(&hits[l](lvlNPC-1, lvlPC-1, 0), &hits[l](lvlNPC-1, lvlPC-1, n), 0)
-                / static_cast<float>(n);
-            }
-        }
-    }
-    for (auto lvlPC : test_levels){
-        for(auto lvlNPC : test_levels){
-            for (int l = 0; l < 4; ++l){
-              NPC_hit_rate[l][lvlNPC-1][lvlPC-1] = std::accumulate(&def[l](lvlNPC-1, lvlPC-1, 0), &def[l](lvlNPC-1, lvlPC-1, n), 0)
-                / static_cast<float>(n);
-            }
-        }
-    }
+    SweepReport report;
+    if (exact)
+        exactRates(PC_hit_rate, NPC_hit_rate, options.weights);
+    else
+        report = simulateRates(options, PC_hit_rate, NPC_hit_rate);
 
     auto t2 = high_resolution_clock::now();
 
@@ -253,6 +315,19 @@ int main(int argc, char* argv[]){
         }
         file.close();
     }
+    // and, for adaptive runs, the battles each cell took
+    if (options.epsilon > 0. && !exact){
+        auto trials_filnames = std::vector<std::string>{"barbarian_trials.csv", "cleric_trials.csv", "rogue_trials.csv", "wizard_trials.csv"};
+        for (unsigned int l = 0; l < 4; ++l){
+            std::ofstream file(trials_filnames[l]);
+            for (auto lvlNPC : test_levels){
+                for (auto lvlPC : test_levels){
+                    file << report.trials[cellIndex(l, lvlNPC, lvlPC)] << ",";
+                }
+                file << std::endl;
+            }
+        }
+    }
 
     // std::cout << "BARBARIAN" << std::endl;
     // plotAsciiHeatmap(PC_hit_rate[0]);
@@ -264,8 +339,25 @@ int main(int argc, char* argv[]){
     // plotAsciiHeatmap(PC_hit_rate[3]);
     // std::cout << std::endl;
 
-    std::cout << "Done testing dndSim for " << n << " points per character and level." << std::endl;
+    if (exact)
+        std::cout << "Done computing the exact hit rates for every character and level." << std::endl;
+    else
+        std::cout << "Done testing dndSim for " << options.n << " points per character and level (engine: " << options.engine << ")." << std::endl;
     std::cout << "Time taken: " << ms_double.count() << " ms" << std::endl;
+    if (!report.hit.empty()){
+        double width = 0.;
+        for (auto const& directed : {report.hit, report.def})
+            for (auto const& interval : directed) width += interval.upper - interval.lower;
+        std::cout << "Mean width of the 95% bootstrap intervals: " << width / (2 * report.hit.size()) << std::endl;
+    }
+    if (options.epsilon > 0. && !exact){
+        const std::size_t spent = std::accumulate(report.trials.begin(), report.trials.end(), std::size_t(0));
+        std::cout << "Battles spent: " << spent << " of " << options.n * report.trials.size()
+                  << " (" << 100. * spent / (options.n * report.trials.size()) << "%), per cell in *_trials.csv" << std::endl;
+    }
+
+    if (hasFlag(argc, argv, "validate") && !exact)
+        validateRates(PC_hit_rate, NPC_hit_rate, options.weights, report);
 
     return 0;
 }
@@ -0,0 +1,149 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "thresholds.h"
+#include <cmath>
+#include <numeric>
+
+namespace dndSim{
+
+std::uint8_t ThresholdTable::pack(Check const& check)
+{
+    return static_cast<std::uint8_t>(std::clamp(check.threshold, 1, 21)) | (check.onSave ? onSaveBit : 0);
+}
+
+ThresholdTable::ThresholdTable(EncType type)
+{
+    crOffset[0] = 0;
+    for (int lvlCR = 1; lvlCR <= 20; ++lvlCR) {
+        crOffset[lvlCR] = crOffset[lvlCR - 1] + encounter_table(lvlCR, type).size();
+    }
+    entries.resize(2 * nPCClasses * 20 * crOffset[20]);
+    dice.resize(2 * nPCClasses * 20);
+
+    for (auto direction : {hit, def}) {
+        for (unsigned int l = 0; l < nPCClasses; ++l) {
+            for (unsigned short int lvlPC = 1; lvlPC <= 20; ++lvlPC) {
+                with_premade(PCClass(l), lvlPC, [&](auto const& pc) {
+                    const std::size_t base = cell(direction, PCClass(l), lvlPC);
+                    for (int lvlCR = 1; lvlCR <= 20; ++lvlCR) {
+                        auto const& table = encounter_table(lvlCR, type);
+                        for (std::size_t i = 0; i < table.size(); ++i) {
+                            const Check check = direction == hit ? attack_check(pc, table[i]) : attack_check(table[i], pc);
+                            if (lvlCR == 1 && i == 0)
+                                dice[slot(direction, PCClass(l), lvlPC)] = check.die;
+                            else if (check.die != dice[slot(direction, PCClass(l), lvlPC)])
+                                throw std::logic_error("The die of a check must not depend on the defender.");
+                            entries[base + crOffset[lvlCR - 1] + i] = pack(check);
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
+
+std::size_t ThresholdTable::slot(Direction direction, PCClass pcClass, unsigned short int lvlPC) const
+{
+    return (direction * nPCClasses + static_cast<unsigned int>(pcClass)) * 20 + lvlPC - 1;
+}
+
+std::size_t ThresholdTable::cell(Direction direction, PCClass pcClass, unsigned short int lvlPC) const
+{
+    return slot(direction, pcClass, lvlPC) * crOffset[20];
+}
+
+std::span<const std::uint8_t> ThresholdTable::checks(Direction direction, PCClass pcClass, unsigned short int lvlPC, int lvlCR) const
+{
+    const std::size_t base = cell(direction, pcClass, lvlPC);
+    return {entries.data() + base + crOffset[lvlCR - 1], entries.data() + base + crOffset[lvlCR]};
+}
+
+Die ThresholdTable::die(Direction direction, PCClass pcClass, unsigned short int lvlPC) const
+{
+    return dice[slot(direction, pcClass, lvlPC)];
+}
+
+Strata allocate_trials(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                       std::size_t n, Allocation allocation, AliasTable const* weights)
+{
+    const auto hitChecks = table.checks(ThresholdTable::hit, pcClass, lvlPC, lvlCR);
+    const auto defChecks = table.checks(ThresholdTable::def, pcClass, lvlPC, lvlCR);
+    const Die hitDie = table.die(ThresholdTable::hit, pcClass, lvlPC);
+    const Die defDie = table.die(ThresholdTable::def, pcClass, lvlPC);
+    const std::size_t m = hitChecks.size();
+
+    Strata strata;
+    strata.probability.resize(m);
+    std::vector<double> share(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        strata.probability[i] = weights ? weights->probability(i) : 1. / m;
+        share[i] = strata.probability[i];
+        if (allocation == Allocation::neyman) {
+            const double hit = probability(ThresholdTable::unpack(hitChecks[i], hitDie));
+            const double def = probability(ThresholdTable::unpack(defChecks[i], defDie));
+            share[i] *= std::sqrt((hit * (1. - hit) + def * (1. - def)) / 2.);
+        }
+    }
+    double total = std::accumulate(share.begin(), share.end(), 0.);
+    if (!(total > 0.)) {
+        share = strata.probability; // every battle is decided, so any split is exact
+        total = 1.;
+    }
+
+    // One trial each, then the rest by largest remainder
+    std::vector<std::size_t> count(m, n >= m ? 1 : 0);
+    const std::size_t rest = n >= m ? n - m : n;
+    std::vector<std::pair<double, std::size_t>> remainder(m);
+    std::size_t given = 0;
+    for (std::size_t i = 0; i < m; ++i) {
+        const double target = rest * share[i] / total;
+        const std::size_t whole = static_cast<std::size_t>(target);
+        count[i] += whole;
+        given += whole;
+        remainder[i] = {target - whole, i};
+    }
+    std::sort(remainder.begin(), remainder.end(), [](auto const& a, auto const& b) { return a.first > b.first; });
+    for (std::size_t j = 0; given < rest; ++j, ++given) ++count[remainder[j % m].second];
+
+    strata.offsets.resize(m + 1);
+    strata.offsets[0] = 0;
+    for (std::size_t i = 0; i < m; ++i) strata.offsets[i + 1] = strata.offsets[i] + count[i];
+    return strata;
+}
+
+void Strata::count(std::size_t first, std::span<const unsigned char> outcomes, std::span<std::size_t> successes) const
+{
+    std::size_t monster = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+    for (std::size_t k = 0; k < outcomes.size(); ++k) {
+        while (offsets[monster + 1] <= first + k) ++monster;
+        successes[monster] += outcomes[k];
+    }
+}
+
+double Strata::rate(std::span<const std::size_t> successes) const
+{
+    double sum = 0., covered = 0.;
+    for (std::size_t i = 0; i < successes.size(); ++i) {
+        const std::size_t trials = offsets[i + 1] - offsets[i];
+        if (trials == 0) continue;
+        sum += probability[i] * successes[i] / trials;
+        covered += probability[i];
+    }
+    return sum / covered;
+}
+}
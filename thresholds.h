@@ -0,0 +1,207 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef THRESHOLDS_H
+#define THRESHOLDS_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include "weights.h"
+
+namespace dndSim{
+
+    // Precomputed checks of every monster against every premade character, so that a
+    // trial reduces to comparing one die roll with one byte. An entry holds the check's
+    // threshold, clamped to [1, 21] (which keeps every outcome), in its low five bits
+    // and the onSave flag in its top bit. The die depends only on the attacker, so it
+    // is stored once per cell rather than per monster.
+    class ThresholdTable {
+    public:
+        enum Direction { hit, def }; // the character attacks, or is attacked
+        static constexpr std::uint8_t thresholdMask = 0x1F;
+        static constexpr std::uint8_t onSaveBit = 0x80;
+
+        explicit ThresholdTable(EncType type = EncType::any);
+
+        // Entries of every monster of CR lvlCR, in the order of encounter_table(lvlCR, type)
+        std::span<const std::uint8_t> checks(Direction direction, PCClass pcClass, unsigned short int lvlPC, int lvlCR) const;
+        Die die(Direction direction, PCClass pcClass, unsigned short int lvlPC) const;
+        std::size_t size() const { return entries.size(); }
+
+        static std::uint8_t pack(Check const& check);
+        static Check unpack(std::uint8_t entry, Die die)
+        {
+            return {entry & thresholdMask, die, bool(entry & onSaveBit)};
+        }
+        static bool succeeds(std::uint8_t entry, unsigned int roll)
+        {
+            return (roll >= (entry & thresholdMask)) != bool(entry & onSaveBit);
+        }
+
+    private:
+        std::vector<std::uint8_t> entries;
+        std::vector<Die> dice;
+        std::array<std::size_t, 21> crOffset;
+        std::size_t slot(Direction direction, PCClass pcClass, unsigned short int lvlPC) const;
+        std::size_t cell(Direction direction, PCClass pcClass, unsigned short int lvlPC) const;
+    };
+
+    template<RNG::Generator G>
+    void fill_rolls(Die die, std::span<unsigned char> out, G& rng)
+    {
+        switch (die) {
+            case Die::d20dl: RNG::fill2d20dl(out, rng); break;
+            case Die::d20dh: RNG::fill2d20dh(out, rng); break;
+            default: RNG::fill1d20(out, rng);
+        }
+    }
+
+    // Runs n battles of one cell of the table, with the encounters of each chunk of
+    // trials chosen by draw(first trial of the chunk, encounter indices, rng), and hands
+    // the outcomes of trial k to record(k, encounter index, hit, def)
+    template<RNG::Generator G, class Draw, class Record>
+    void run_battles(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                     std::size_t n, G& rng, Draw&& draw, Record&& record)
+    {
+        const auto hitChecks = table.checks(ThresholdTable::hit, pcClass, lvlPC, lvlCR);
+        const auto defChecks = table.checks(ThresholdTable::def, pcClass, lvlPC, lvlCR);
+        const Die hitDie = table.die(ThresholdTable::hit, pcClass, lvlPC);
+        const Die defDie = table.die(ThresholdTable::def, pcClass, lvlPC);
+
+        constexpr std::size_t chunk = 256;
+        unsigned int encounter[chunk];
+        unsigned char hitRoll[chunk], defRoll[chunk];
+        for (std::size_t i = 0; i < n; i += chunk) {
+            const std::size_t m = std::min(chunk, n - i);
+            draw(i, std::span<unsigned int>(encounter, m), rng);
+            fill_rolls(hitDie, {hitRoll, m}, rng);
+            fill_rolls(defDie, {defRoll, m}, rng);
+            for (std::size_t k = 0; k < m; ++k) {
+                record(i + k, encounter[k], ThresholdTable::succeeds(hitChecks[encounter[k]], hitRoll[k]),
+                       ThresholdTable::succeeds(defChecks[encounter[k]], defRoll[k]));
+            }
+        }
+    }
+
+    template<RNG::Generator G>
+    void draw_encounters(std::span<unsigned int> encounter, std::size_t nMonsters, AliasTable const* weights, G& rng)
+    {
+        if (weights)
+            for (auto& e : encounter) e = weights->sample(rng);
+        else
+            for (auto& e : encounter) e = RNG::genRNG(nMonsters, rng);
+    }
+
+    // Branch-free Monte Carlo over one cell of the table: runs hits.size() battles of the
+    // premade character against random encounters of CR lvlCR and stores whether it hit
+    // (hits) and was hit (defs). Encounters and rolls are drawn a chunk at a time, the
+    // encounters uniformly or, given their alias table, by weight.
+    template<RNG::Generator G>
+    void simulate_cell(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                       std::span<unsigned char> hits, std::span<unsigned char> defs, G& rng,
+                       AliasTable const* weights = nullptr)
+    {
+        const std::size_t nMonsters = table.checks(ThresholdTable::hit, pcClass, lvlPC, lvlCR).size();
+        run_battles(table, pcClass, lvlPC, lvlCR, hits.size(), rng,
+                    [&](std::size_t, std::span<unsigned int> encounter, G& rng) { draw_encounters(encounter, nMonsters, weights, rng); },
+                    [&](std::size_t k, unsigned int, bool hit, bool def) { hits[k] = hit; defs[k] = def; });
+    }
+
+    struct BattleCounts {
+        std::size_t hits = 0, defs = 0;
+    };
+
+    // Fused form of simulate_cell for callers that only need the rates: counts the
+    // successes of n battles as they are resolved instead of storing the outcomes.
+    // It draws the same numbers, so the counts equal those of the stored outcomes.
+    template<RNG::Generator G>
+    BattleCounts count_cell(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                            std::size_t n, G& rng, AliasTable const* weights = nullptr)
+    {
+        const std::size_t nMonsters = table.checks(ThresholdTable::hit, pcClass, lvlPC, lvlCR).size();
+        BattleCounts counts;
+        run_battles(table, pcClass, lvlPC, lvlCR, n, rng,
+                    [&](std::size_t, std::span<unsigned int> encounter, G& rng) { draw_encounters(encounter, nMonsters, weights, rng); },
+                    [&](std::size_t, unsigned int, bool hit, bool def) { counts.hits += hit; counts.defs += def; });
+        return counts;
+    }
+
+    // Stratified sampling of a cell: rather than drawing the monster of each battle,
+    // the trials are shared out among the monsters, which removes the variance of the
+    // encounter from the estimate and leaves that of the rolls.
+    //  - proportional gives monster i a share p_i of the trials, p_i being its
+    //    encounter probability
+    //  - neyman gives it a share proportional to p_i * sigma_i, sigma_i being the
+    //    standard deviation of one battle, here taken from the exact probabilities of
+    //    the table and averaged over both directions
+    // Every monster gets at least one trial while there are enough of them.
+    enum class Allocation { proportional, neyman };
+
+    struct Strata {
+        std::vector<std::size_t> offsets;   // monster i fights trials [offsets[i], offsets[i + 1])
+        std::vector<double> probability;    // p_i
+
+        std::size_t trials() const { return offsets.back(); }
+        // Adds the outcomes of trials [first, first + outcomes.size()) to the successes
+        // of their monsters
+        void count(std::size_t first, std::span<const unsigned char> outcomes, std::span<std::size_t> successes) const;
+        // The estimate sum_i p_i * (mean outcome of monster i) over the monsters with
+        // trials, renormalised when some have none
+        double rate(std::span<const std::size_t> successes) const;
+    };
+
+    Strata allocate_trials(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                           std::size_t n, Allocation allocation, AliasTable const* weights = nullptr);
+
+    inline void draw_strata(Strata const& strata, std::size_t first, std::size_t& monster, std::span<unsigned int> encounter)
+    {
+        for (std::size_t k = 0; k < encounter.size(); ++k) {
+            while (strata.offsets[monster + 1] <= first + k) ++monster;
+            encounter[k] = monster;
+        }
+    }
+
+    // Runs trials [first, first + hits.size()) of a cell allocated by allocate_trials
+    template<RNG::Generator G>
+    void simulate_strata(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                         Strata const& strata, std::size_t first,
+                         std::span<unsigned char> hits, std::span<unsigned char> defs, G& rng)
+    {
+        auto const& offsets = strata.offsets;
+        std::size_t monster = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+        run_battles(table, pcClass, lvlPC, lvlCR, hits.size(), rng,
+                    [&](std::size_t i, std::span<unsigned int> encounter, G&) { draw_strata(strata, first + i, monster, encounter); },
+                    [&](std::size_t k, unsigned int, bool hit, bool def) { hits[k] = hit; defs[k] = def; });
+    }
+
+    // Fused form of simulate_strata: runs trials [first, first + n) and adds their
+    // successes to those of their monsters
+    template<RNG::Generator G>
+    void count_strata(ThresholdTable const& table, PCClass pcClass, unsigned short int lvlPC, int lvlCR,
+                      Strata const& strata, std::size_t first, std::size_t n,
+                      std::span<std::size_t> hitSuccesses, std::span<std::size_t> defSuccesses, G& rng)
+    {
+        auto const& offsets = strata.offsets;
+        std::size_t monster = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+        run_battles(table, pcClass, lvlPC, lvlCR, n, rng,
+                    [&](std::size_t i, std::span<unsigned int> encounter, G&) { draw_strata(strata, first + i, monster, encounter); },
+                    [&](std::size_t, unsigned int e, bool hit, bool def) { hitSuccesses[e] += hit; defSuccesses[e] += def; });
+    }
+}
+
+#endif // THRESHOLDS_H
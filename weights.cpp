@@ -0,0 +1,87 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#include "weights.h"
+#include <cmath>
+
+namespace dndSim{
+
+AliasTable::AliasTable(std::span<const double> weights)
+{
+    const std::size_t n = weights.size();
+    if (n == 0 || n > 0xFFFFFFFFu) throw std::invalid_argument("An alias table needs 1 to 2^32 - 1 outcomes.");
+    double total = 0.;
+    for (double w : weights) {
+        if (!std::isfinite(w) || w < 0.) throw std::invalid_argument("Weights must be finite and non-negative.");
+        total += w;
+    }
+    if (!(total > 0.) || !std::isfinite(total)) throw std::invalid_argument("Weights must have a positive, finite sum.");
+
+    // Vose: scale to a mean of one, then pair every column below one with a column
+    // above it, which donates the difference and stays in its list while it is large
+    probabilities.resize(n);
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small, large;
+    for (std::size_t i = 0; i < n; ++i) {
+        probabilities[i] = weights[i] / total;
+        scaled[i] = probabilities[i] * n;
+        (scaled[i] < 1. ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+    std::vector<double> keep(n, 1.);
+    std::vector<std::uint32_t> alias(n);
+    for (std::size_t i = 0; i < n; ++i) alias[i] = static_cast<std::uint32_t>(i);
+    while (!small.empty() && !large.empty()) {
+        const std::uint32_t s = small.back(), l = large.back();
+        small.pop_back();
+        keep[s] = scaled[s];
+        alias[s] = l;
+        scaled[l] -= 1. - scaled[s];
+        if (scaled[l] < 1.) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Whatever is left is one up to rounding
+
+    columns.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double threshold = std::ldexp(keep[i], 64);
+        columns[i].alias = alias[i];
+        columns[i].threshold = threshold >= 0x1p64 ? ~std::uint64_t(0) : static_cast<std::uint64_t>(threshold);
+        if (keep[i] >= 1.) columns[i].alias = static_cast<std::uint32_t>(i);
+    }
+}
+
+EncounterWeights::EncounterWeights(MonsterWeight const& weight)
+{
+    std::vector<double> w;
+    for (auto type : {EncType::any, EncType::spellcaster, EncType::regular}) {
+        for (int lvlCR = 1; lvlCR <= 20; ++lvlCR) {
+            auto const& monsters = encounter_table(lvlCR, type);
+            w.resize(monsters.size());
+            for (std::size_t i = 0; i < monsters.size(); ++i) w[i] = weight(monsters.stats(i));
+            pools[static_cast<int>(type)][lvlCR - 1] = AliasTable(w);
+        }
+    }
+}
+
+AliasTable const& EncounterWeights::table(int lvlCR, EncType type) const
+{
+    encounter_table(lvlCR, type); // validates the arguments
+    return pools[static_cast<int>(type)][lvlCR - 1];
+}
+}
@@ -0,0 +1,129 @@
+//==============================================================================
+//   _____ ___ ______      ______  _____ ________  ___
+//  |_   _/ _ \|  _  \___  |  _  \/  ___|_   _|  \/  |
+//    | |/ /_\ \ | | ( _ ) | | | |\ `--.  | | | .  . |
+//    | ||  _  | | | / _ \/\ | | | `--. \ | | | |\/| |
+//    | || | | | |/ / (_>  < |/ / /\__/ /_| |_| |  | |
+//    \_/\_| |_/___/ \___/\/___/  \____/ \___/\_|  |_/
+//
+//==============================================================================
+// TOTALLY ACCURATE D&D SIMULATOR
+// A library for simulating D&D combat totally accurately.
+//==============================================================================
+// Copyright (C) 2024 CERN
+// Licensed under the GNU Lesser General Public License (version 3 or later).
+// Written by: Z. Wettersten (Mar 2024) for iCSC 2024.
+//==============================================================================
+
+#ifndef WEIGHTS_H
+#define WEIGHTS_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+#include "dndSim.h"
+
+namespace dndSim{
+
+    // Vose's alias table over n outcomes with arbitrary non-negative weights. A draw
+    // takes one word of the engine: its multiply-shift by n picks a column, and the low
+    // half of the same product is compared with the column's threshold to keep the
+    // column or take its alias. Throws std::invalid_argument unless the weights are
+    // finite, non-negative and have a positive sum.
+    class AliasTable {
+    public:
+        AliasTable() = default;
+        explicit AliasTable(std::span<const double> weights);
+
+        std::size_t size() const { return columns.size(); }
+        // Normalised weight of outcome i, for the exact engine
+        double probability(std::size_t i) const { return probabilities[i]; }
+
+        std::uint32_t sample(std::uint64_t word) const
+        {
+            std::uint64_t lo;
+            const std::uint64_t i = RNG::mul128(word, columns.size(), lo);
+            return select(lo < columns[i].threshold, static_cast<std::uint32_t>(i), columns[i].alias);
+        }
+
+        // The same with a 32-bit word, whose thresholds are the top halves of the 64-bit ones
+        std::uint32_t sample(std::uint32_t word) const
+        {
+            const std::uint64_t m = std::uint64_t(word) * columns.size();
+            const std::uint32_t i = static_cast<std::uint32_t>(m >> 32);
+            return select(static_cast<std::uint32_t>(m) < (columns[i].threshold >> 32), i, columns[i].alias);
+        }
+
+        // Draws one word of the engine's width
+        template<RNG::Generator G>
+        std::uint32_t sample(G& rng) const
+        {
+            if constexpr (G::max() == 0xFFFFFFFFu)
+                return sample(static_cast<std::uint32_t>(rng()));
+            else
+                return sample(static_cast<std::uint64_t>(rng()));
+        }
+
+    private:
+        // Branch-free, since whether a draw keeps its column is a coin flip
+        static std::uint32_t select(bool keep, std::uint32_t column, std::uint32_t alias)
+        {
+            return alias ^ ((column ^ alias) & (0u - keep));
+        }
+
+        // Kept together so that a draw touches one entry
+        struct Column {
+            std::uint64_t threshold; // keeps the column when lo < threshold, in units of 2^-64
+            std::uint32_t alias;
+        };
+        std::vector<Column> columns;
+        std::vector<double> probabilities;
+    };
+
+    // The weight of a monster in an encounter, e.g. how common it is in the campaign
+    using MonsterWeight = std::function<double(MonsterStats const&)>;
+
+    // Weighted encounters: one alias table per pool and CR of the active catalogue, so
+    // that the EncType filters keep working and a weighted draw costs one word, like a
+    // uniform one. Build it after use_catalog, since it follows the tables' indices.
+    class EncounterWeights {
+    public:
+        explicit EncounterWeights(MonsterWeight const& weight);
+
+        AliasTable const& table(int lvlCR, EncType type) const;
+
+    private:
+        std::array<std::array<AliasTable, 20>, 3> pools;
+    };
+
+    template<RNG::Generator G>
+    monster random_monster(EncounterWeights const& weights, int lvlCR, EncType type, G& rng)
+    {
+        return encounter_table(lvlCR, type)[weights.table(lvlCR, type).sample(rng)];
+    }
+
+    // Weighted counterparts of exact_hit_rate and exact_def_rate
+    template<class PC>
+    double exact_hit_rate(PC const& pc, EncounterWeights const& weights, int lvlCR, EncType type = EncType::any)
+    {
+        auto const& table = encounter_table(lvlCR, type);
+        auto const& alias = weights.table(lvlCR, type);
+        double sum = 0.;
+        for (std::size_t i = 0; i < table.size(); ++i) sum += alias.probability(i) * probability(attack_check(pc, table[i]));
+        return sum;
+    }
+
+    template<class PC>
+    double exact_def_rate(PC const& pc, EncounterWeights const& weights, int lvlCR, EncType type = EncType::any)
+    {
+        auto const& table = encounter_table(lvlCR, type);
+        auto const& alias = weights.table(lvlCR, type);
+        double sum = 0.;
+        for (std::size_t i = 0; i < table.size(); ++i) sum += alias.probability(i) * probability(attack_check(table[i], pc));
+        return sum;
+    }
+}
+
+#endif // WEIGHTS_H